@@ -0,0 +1,196 @@
+/*
+  ==============================================================================
+
+    BenchmarkHarness.cpp
+    Created: 18 Oct 2026 8:40:13pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "BenchmarkHarness.h"
+#include <iostream>
+
+#if JUCE_LINUX || JUCE_MAC
+ #include <sys/resource.h>
+ #include <time.h>
+ #include <unistd.h>
+#endif
+
+#if JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+namespace Benchmark
+{
+
+//==============================================================================
+Options Options::parse(const juce::ArgumentList& args, const double& defaultSecondsPerCase)
+{
+    Options options;
+    
+    if ( args.containsOption("--output") )
+        options.output = args.getFileForOption("--output");
+    
+    options.filter = args.getValueForOption("--filter");
+    options.quick = args.containsOption("--quick");
+    
+    options.secondsPerCase = args.containsOption("--seconds") ? args.getValueForOption("--seconds").getDoubleValue()
+                                                              : defaultSecondsPerCase;
+    
+    // a quick run is for checking the thing works, not for numbers
+    if ( options.quick )
+        options.secondsPerCase = juce::jmin(options.secondsPerCase, defaultSecondsPerCase / 10.0);
+    
+    return options;
+}
+
+bool Options::matches(const juce::String& caseName) const
+{
+    return filter.isEmpty() || caseName.containsIgnoreCase(filter);
+}
+
+double nowNanoseconds()
+{
+    return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks()) * 1.0e9;
+}
+
+juce::int64 getResidentBytes()
+{
+   #if JUCE_LINUX
+    // second field of statm is resident pages
+    auto fields = juce::StringArray::fromTokens(juce::File("/proc/self/statm").loadFileAsString(), false);
+    
+    if ( fields.size() > 1 )
+        return fields[1].getLargeIntValue() * static_cast<juce::int64>(sysconf(_SC_PAGESIZE));
+   #elif JUCE_MAC
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    
+    if ( task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS )
+        return static_cast<juce::int64>(info.resident_size);
+   #endif
+    
+    return -1;
+}
+
+double getProcessCpuSeconds()
+{
+   #if JUCE_LINUX || JUCE_MAC
+    rusage usage;
+    
+    if ( getrusage(RUSAGE_SELF, &usage) == 0 )
+    {
+        auto toSeconds = [](const timeval& t) { return static_cast<double>(t.tv_sec) + (t.tv_usec * 1.0e-6); };
+        return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+    }
+   #endif
+    
+    return -1.0;
+}
+
+double getThreadCpuSeconds()
+{
+   #if JUCE_LINUX || JUCE_MAC
+    timespec t;
+    
+    if ( clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t) == 0 )
+        return static_cast<double>(t.tv_sec) + (t.tv_nsec * 1.0e-9);
+   #endif
+    
+    return -1.0;
+}
+
+double percentile(std::vector<double>& values, const double& fraction)
+{
+    if ( values.empty() )
+        return 0.0;
+    
+    std::sort(values.begin(), values.end());
+    
+    auto index = static_cast<int>(std::ceil(fraction * values.size())) - 1;
+    return values[static_cast<size_t>(juce::jlimit(0, static_cast<int>(values.size()) - 1, index))];
+}
+
+juce::var getEnvironment()
+{
+    auto* environment = new juce::DynamicObject();
+    
+    environment->setProperty("time",        juce::Time::getCurrentTime().toISO8601(true));
+    environment->setProperty("os",          juce::SystemStats::getOperatingSystemName());
+    environment->setProperty("cpu",         juce::SystemStats::getCpuModel());
+    environment->setProperty("cpuVendor",   juce::SystemStats::getCpuVendor());
+    environment->setProperty("cpuMHz",      juce::SystemStats::getCpuSpeedInMegahertz());
+    environment->setProperty("logicalCpus", juce::SystemStats::getNumCpus());
+    environment->setProperty("memoryMB",    juce::SystemStats::getMemorySizeInMegabytes());
+    environment->setProperty("juce",        juce::SystemStats::getJUCEVersion());
+    environment->setProperty("hasAVX2",     juce::SystemStats::hasAVX2());
+    environment->setProperty("hasNeon",     juce::SystemStats::hasNeon());
+   
+   #if JUCE_DEBUG
+    environment->setProperty("build", "Debug");
+   #else
+    environment->setProperty("build", "Release");
+   #endif
+   
+   #if defined(__clang__)
+    environment->setProperty("compiler", "clang " __clang_version__);
+   #elif defined(__GNUC__)
+    environment->setProperty("compiler", "gcc " __VERSION__);
+   #elif defined(_MSC_VER)
+    environment->setProperty("compiler", "msvc " + juce::String(_MSC_VER));
+   #endif
+   
+    return juce::var(environment);
+}
+
+bool writeReport(const juce::String& suite,
+                 const juce::Array<juce::var>& results,
+                 const Options& options,
+                 const juce::Array<juce::var>& checks)
+{
+    auto* report = new juce::DynamicObject();
+    report->setProperty("suite", suite);
+    report->setProperty("environment", getEnvironment());
+    report->setProperty("results", juce::var(results));
+    
+    if ( !checks.isEmpty() )
+        report->setProperty("checks", juce::var(checks));
+    
+    auto json = juce::JSON::toString(juce::var(report));
+    
+    if ( options.output == juce::File() )
+    {
+        std::cout << json << std::endl;
+        return true;
+    }
+    
+    if ( !options.output.replaceWithText(json) )
+    {
+        log("couldn't write " + options.output.getFullPathName());
+        return false;
+    }
+    
+    log("wrote " + options.output.getFullPathName());
+    return true;
+}
+
+void log(const juce::String& message)
+{
+    std::cerr << message << std::endl;
+}
+
+void fillWithNoise(juce::AudioBuffer<float>& buffer, const juce::int64& seed)
+{
+    juce::Random random(seed);
+    
+    for ( auto ch = 0; ch < buffer.getNumChannels(); ++ch )
+    {
+        auto* samples = buffer.getWritePointer(ch);
+        
+        for ( auto i = 0; i < buffer.getNumSamples(); ++i )
+            samples[i] = (random.nextFloat() * 2.f) - 1.f;
+    }
+}
+
+}
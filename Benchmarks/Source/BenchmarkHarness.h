@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    BenchmarkHarness.h
+    Created: 18 Oct 2026 8:40:13pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+
+//==============================================================================
+/*
+Bits shared by the headless benchmark executables: command line options,
+timing, statistics and the JSON report.
+Every report has the same shape so results from different releases can be
+diffed by a script:
+{ "suite": ..., "environment": { ... }, "results": [ { ... }, ... ] }
+plus "checks": [ { ... }, ... ] from suites that verify accuracy as well.
+*/
+namespace Benchmark
+{
+
+struct Options
+{
+    juce::File output;      // --output <file>, stdout when empty
+    juce::String filter;    // --filter <text>, only cases whose name contains it
+    bool quick = false;     // --quick, a reduced sweep for smoke testing
+    double secondsPerCase = 0.0; // --seconds <s>, time spent measuring each case
+    
+    static Options parse(const juce::ArgumentList& args, const double& defaultSecondsPerCase);
+    bool matches(const juce::String& caseName) const;
+};
+
+// wall clock in nanoseconds from the high resolution counter
+double nowNanoseconds();
+
+// -1 where the platform doesn't say
+juce::int64 getResidentBytes();
+double getProcessCpuSeconds();
+double getThreadCpuSeconds();
+
+// values is sorted in place
+double percentile(std::vector<double>& values, const double& fraction);
+
+juce::var getEnvironment();
+
+// writes the report to options.output or stdout, returns false if the file couldn't be written
+bool writeReport(const juce::String& suite,
+                 const juce::Array<juce::var>& results,
+                 const Options& options,
+                 const juce::Array<juce::var>& checks = {});
+
+// progress goes to stderr so stdout stays valid JSON
+void log(const juce::String& message);
+
+// deterministic white noise between -1 and +1
+void fillWithNoise(juce::AudioBuffer<float>& buffer, const juce::int64& seed);
+
+}
@@ -0,0 +1,319 @@
+/*
+  ==============================================================================
+
+    DspKernels.cpp
+    Created: 18 Oct 2026 8:52:37pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "DspKernels.h"
+#include "../../Source/Averager.h"
+#include "../../Source/CircularBuffer.h"
+#include "../../Source/CorrelationAnalyzer.h"
+#include "../../Source/Decimator.h"
+#include "../../Source/FrameAnalyzer.h"
+#include "../../Source/AnalysisState.h"
+#include "../../Source/LevelPyramid.h"
+#include "../../Source/SignalGenerator.h"
+
+namespace
+{
+
+//==============================================================================
+// what the editor used to do with every block pulled from the fifo:
+// one getMagnitude and one getRMSLevel pass per channel
+struct TwoPassLevels : DspKernel
+{
+    juce::String getName() const override { return "levels.twoPass"; }
+    
+    void prepare(const KernelConfig&) override { sum = 0.f; }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>&) override
+    {
+        auto numSamples = main.getNumSamples();
+        
+        for ( auto ch = 0; ch < main.getNumChannels(); ++ch )
+            sum += main.getMagnitude(ch, 0, numSamples) + main.getRMSLevel(ch, 0, numSamples);
+    }
+    
+    float getChecksum() const override { return sum; }
+
+private:
+    float sum = 0.f;
+};
+
+//==============================================================================
+// the audio thread analysis exactly as processBlock runs it
+struct FrameAnalysis : DspKernel
+{
+    FrameAnalysis(const juce::String& n, const bool& withReference, const bool& withCorrelation)
+        : name(n), useReference(withReference), measureCorrelation(withCorrelation)
+    {
+    }
+    
+    juce::String getName() const override { return name; }
+    
+    void prepare(const KernelConfig& config) override
+    {
+        analyzer.prepare(config.sampleRate, config.blockSize);
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>& reference) override
+    {
+        analyzer.process(main, useReference ? reference : noReference, history, measureCorrelation);
+    }
+    
+    float getChecksum() const override { return static_cast<float>(history.getNumWritten()); }
+
+private:
+    juce::String name;
+    bool useReference;
+    bool measureCorrelation;
+    
+    juce::AudioBuffer<float> noReference;
+    FrameAnalyzer analyzer;
+    AnalysisHistory history;
+};
+
+//==============================================================================
+// the correlation analysis on its own, what CorrelationMeter::update used to do
+struct Correlation : DspKernel
+{
+    juce::String getName() const override { return "correlation"; }
+    
+    void prepare(const KernelConfig& config) override
+    {
+        analyzer.prepare(config.sampleRate, config.blockSize, config.blockSize);
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>&) override
+    {
+        auto right = juce::jmin(1, main.getNumChannels() - 1);
+        analyzer.process(main.getReadPointer(0), main.getReadPointer(right), main.getNumSamples());
+    }
+    
+    float getChecksum() const override { return analyzer.getAverageCorrelation(); }
+
+private:
+    CorrelationAnalyzer analyzer;
+};
+
+//==============================================================================
+// the half-band cascade on its own, down to the rate the correlation runs at
+struct Decimation : DspKernel
+{
+    juce::String getName() const override { return "decimator"; }
+    
+    void prepare(const KernelConfig& config) override
+    {
+        for ( auto& decimator : decimators )
+            decimator.prepare(config.sampleRate, CorrelationAnalyzer::minimumAnalysisRate);
+        
+        output.resize(static_cast<size_t>(config.blockSize + 1));
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>&) override
+    {
+        auto numChannels = juce::jmin(main.getNumChannels(), static_cast<int>(decimators.size()));
+        
+        for ( auto ch = 0; ch < numChannels; ++ch )
+        {
+            auto numOutputs = decimators[static_cast<size_t>(ch)].process(main.getReadPointer(ch), output.data(), main.getNumSamples());
+            
+            if ( numOutputs > 0 )
+                checksum += output[static_cast<size_t>(numOutputs - 1)];
+        }
+    }
+    
+    float getChecksum() const override { return checksum; }
+
+private:
+    std::array<Decimator, 2> decimators;
+    std::vector<float> output;
+    float checksum = 0.f;
+};
+
+//==============================================================================
+// one add per sample, sized like the averaged correlation window
+struct AveragerAdd : DspKernel
+{
+    juce::String getName() const override { return "averager.add"; }
+    
+    void prepare(const KernelConfig& config) override
+    {
+        averager.resize(static_cast<size_t>(config.blockSize) * 6, 0.f);
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>&) override
+    {
+        for ( auto ch = 0; ch < main.getNumChannels(); ++ch )
+        {
+            auto* samples = main.getReadPointer(ch);
+            
+            for ( auto i = 0; i < main.getNumSamples(); ++i )
+                averager.add(samples[i]);
+        }
+    }
+    
+    float getChecksum() const override { return averager.getAverage(); }
+
+private:
+    Averager<float> averager { 1, 0.f };
+};
+
+//==============================================================================
+// one write per sample into a histogram sized buffer
+struct CircularBufferWrite : DspKernel
+{
+    juce::String getName() const override { return "circularBuffer.write"; }
+    
+    void prepare(const KernelConfig&) override
+    {
+        buffer.clear(0.f);
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>&) override
+    {
+        for ( auto ch = 0; ch < main.getNumChannels(); ++ch )
+        {
+            auto* samples = main.getReadPointer(ch);
+            
+            for ( auto i = 0; i < main.getNumSamples(); ++i )
+                buffer.write(samples[i]);
+        }
+    }
+    
+    float getChecksum() const override { return buffer.getNewest(); }
+
+private:
+    CircularBuffer<float> buffer { 776, 0.f };
+};
+
+//==============================================================================
+// one push per sample into a level history, so every level above gets its share
+struct LevelPyramidPush : DspKernel
+{
+    juce::String getName() const override { return "levelPyramid.push"; }
+    
+    void prepare(const KernelConfig&) override
+    {
+        pyramid = std::make_unique<LevelPyramid>();
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>&) override
+    {
+        for ( auto ch = 0; ch < main.getNumChannels(); ++ch )
+        {
+            auto* samples = main.getReadPointer(ch);
+            
+            for ( auto i = 0; i < main.getNumSamples(); ++i )
+                pyramid->push(samples[i]);
+        }
+    }
+    
+    float getChecksum() const override
+    {
+        auto newest = static_cast<juce::int64>(pyramid->getNumPushed());
+        return pyramid->get(newest - 1, newest).mean;
+    }
+
+private:
+    std::unique_ptr<LevelPyramid> pyramid;
+};
+
+//==============================================================================
+// audio thread analysis plus the message thread replay into meters and histories,
+// run back to back so the cost of a frame is attributed to the samples that made it
+struct Pipeline : DspKernel
+{
+    juce::String getName() const override { return "pipeline"; }
+    
+    void prepare(const KernelConfig& config) override
+    {
+        // loudness too, as the plugin measures it for the session timeline
+        analyzer.prepare(config.sampleRate, config.blockSize, true);
+        state = std::make_unique<AnalysisState>();
+        state->meters.setNumChannels(config.numChannels);
+        
+        nowMs = 0;
+        msPerBlock = 1000.0 * config.blockSize / config.sampleRate;
+        elapsedMs = 0.0;
+    }
+    
+    void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>& reference) override
+    {
+        analyzer.process(main, reference, state->history, true);
+        
+        elapsedMs += msPerBlock;
+        nowMs = static_cast<juce::int64>(elapsedMs);
+        state->update(nowMs);
+        state->updateLevels();
+    }
+    
+    float getChecksum() const override { return state->meters.getMeanRmsDb(Main); }
+
+private:
+    FrameAnalyzer analyzer;
+    std::unique_ptr<AnalysisState> state;
+    
+    juce::int64 nowMs = 0;
+    double msPerBlock = 0.0;
+    double elapsedMs = 0.0;
+};
+
+//==============================================================================
+// test signal rendering into a buffer of the same shape as the input
+struct Generator : DspKernel
+{
+    Generator(const juce::String& n, const SignalGenerator::Type& t) : name(n), type(t) {}
+    
+    juce::String getName() const override { return name; }
+    
+    void prepare(const KernelConfig& config) override
+    {
+        output.setSize(config.numChannels, config.blockSize);
+        generator.prepare(config.sampleRate, config.blockSize);
+        generator.setType(type);
+    }
+    
+    void process(const juce::AudioBuffer<float>&, const juce::AudioBuffer<float>&) override
+    {
+        generator.render(output);
+        sum += output.getSample(0, 0);
+    }
+    
+    float getChecksum() const override { return sum; }
+    
+private:
+    juce::String name;
+    SignalGenerator::Type type;
+    SignalGenerator generator;
+    juce::AudioBuffer<float> output;
+    float sum = 0.f;
+};
+
+}
+
+//==============================================================================
+std::vector<std::unique_ptr<DspKernel>> createDspKernels()
+{
+    std::vector<std::unique_ptr<DspKernel>> kernels;
+    
+    kernels.push_back(std::make_unique<TwoPassLevels>());
+    kernels.push_back(std::make_unique<FrameAnalysis>("frame.levels", false, false));
+    kernels.push_back(std::make_unique<FrameAnalysis>("frame.levelsWithReference", true, false));
+    kernels.push_back(std::make_unique<FrameAnalysis>("frame.levelsAndCorrelation", false, true));
+    kernels.push_back(std::make_unique<Correlation>());
+    kernels.push_back(std::make_unique<Decimation>());
+    kernels.push_back(std::make_unique<AveragerAdd>());
+    kernels.push_back(std::make_unique<CircularBufferWrite>());
+    kernels.push_back(std::make_unique<LevelPyramidPush>());
+    kernels.push_back(std::make_unique<Pipeline>());
+    kernels.push_back(std::make_unique<Generator>("generator.sine", SignalGenerator::Sine));
+    kernels.push_back(std::make_unique<Generator>("generator.logSweep", SignalGenerator::LogSweep));
+    kernels.push_back(std::make_unique<Generator>("generator.pinkNoise", SignalGenerator::PinkNoise));
+    
+    return kernels;
+}
@@ -0,0 +1,46 @@
+/*
+  ==============================================================================
+
+    DspKernels.h
+    Created: 18 Oct 2026 8:52:37pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <memory>
+#include <vector>
+
+//==============================================================================
+/*
+The analysis code the plugin runs per block, wrapped so the benchmark can
+drive each piece on its own.
+Kernels own all of their state and allocate only in prepare(), the same
+contract as prepareToPlay / processBlock.
+*/
+struct KernelConfig
+{
+    double sampleRate = 48000.0;
+    int blockSize = 512;
+    int numChannels = 2;
+};
+
+struct DspKernel
+{
+    virtual ~DspKernel() = default;
+    
+    virtual juce::String getName() const = 0;
+    
+    virtual void prepare(const KernelConfig& config) = 0;
+    
+    // reference has the same size as main; kernels that don't use it ignore it
+    virtual void process(const juce::AudioBuffer<float>& main, const juce::AudioBuffer<float>& reference) = 0;
+    
+    // something derived from the results, so the optimiser can't throw the work away
+    virtual float getChecksum() const = 0;
+};
+
+std::vector<std::unique_ptr<DspKernel>> createDspKernels();
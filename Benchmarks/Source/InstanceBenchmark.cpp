@@ -0,0 +1,218 @@
+/*
+  ==============================================================================
+
+    InstanceBenchmark.cpp
+    Created: 18 Oct 2026 10:37:25pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "InstanceBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "ScriptedSignal.h"
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/PluginEditor.h"
+#include "../../Source/FrameProfiler.h"
+
+namespace
+{
+
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 512;
+
+std::vector<int> getInstanceCounts(const bool& quick)
+{
+    if ( quick )
+        return { 1, 8 };
+    
+    return { 1, 8, 32, 128 };
+}
+
+struct Instance
+{
+    Instance()
+    {
+        processor.prepareToPlay(sampleRate, blockSize);
+        editor = std::make_unique<PFMProject10AudioProcessorEditor>(processor);
+    }
+    
+    ~Instance()
+    {
+        editor.reset();
+        processor.releaseResources();
+    }
+    
+    PFMProject10AudioProcessor processor;
+    std::unique_ptr<PFMProject10AudioProcessorEditor> editor;
+};
+
+//==============================================================================
+// one audio thread for every instance, as most hosts do, paced at realtime
+struct HostThread : juce::Thread
+{
+    explicit HostThread(std::vector<std::unique_ptr<Instance>>& i)
+        : juce::Thread("host audio"), instances(i), buffer(2, blockSize)
+    {
+        signal.prepare(sampleRate);
+    }
+    
+    void run() override
+    {
+        auto blockNs = 1.0e9 * blockSize / sampleRate;
+        auto start = Benchmark::nowNanoseconds();
+        auto cpuStart = Benchmark::getThreadCpuSeconds();
+        
+        for ( auto block = 1; !threadShouldExit(); ++block )
+        {
+            signal.render(buffer);
+            
+            auto processStart = Benchmark::nowNanoseconds();
+            
+            for ( auto& instance : instances )
+            {
+                // every instance gets the same input, processBlock may write to it
+                scratch.makeCopyOf(buffer, true);
+                instance->processor.processBlock(scratch, midi);
+            }
+            
+            processNs += Benchmark::nowNanoseconds() - processStart;
+            ++numBlocks;
+            
+            auto aheadMs = (start + (block * blockNs) - Benchmark::nowNanoseconds()) * 1.0e-6;
+            
+            if ( aheadMs >= 1.0 )
+                juce::Thread::sleep(static_cast<int>(aheadMs));
+        }
+        
+        cpuSeconds = Benchmark::getThreadCpuSeconds() - cpuStart;
+    }
+    
+    double processNs = 0.0;
+    double cpuSeconds = 0.0;
+    int numBlocks = 0;
+
+private:
+    std::vector<std::unique_ptr<Instance>>& instances;
+    juce::AudioBuffer<float> buffer;
+    juce::AudioBuffer<float> scratch { 2, blockSize };
+    juce::MidiBuffer midi;
+    ScriptedSignal signal;
+};
+
+juce::var runCase(const int& numInstances, const double& seconds)
+{
+    auto rssBefore = Benchmark::getResidentBytes();
+    
+    std::vector<std::unique_ptr<Instance>> instances;
+    
+    for ( auto i = 0; i < numInstances; ++i )
+        instances.push_back(std::make_unique<Instance>());
+    
+    auto rssAfter = Benchmark::getResidentBytes();
+    
+    // one shared canvas, so the benchmark's own images don't show up as instance memory
+    auto editorBounds = instances.front()->editor->getLocalBounds();
+    juce::Image canvas(juce::Image::ARGB, editorBounds.getWidth(), editorBounds.getHeight(), true);
+    
+    HostThread host(instances);
+    host.startThread();
+    
+    for ( auto& instance : instances )
+        instance->editor->getProfiler().setEnabled(true);
+    
+    auto numFrames = juce::jmax(1, juce::roundToInt(seconds * MeterBallistics::frameRateHz));
+    auto frameMs = 1000.0 / MeterBallistics::frameRateHz;
+    
+    auto wallStart = Benchmark::nowNanoseconds();
+    auto processCpuStart = Benchmark::getProcessCpuSeconds();
+    auto dispatchCpu = 0.0;
+    auto paintCpu = 0.0;
+    
+    for ( auto frame = 1; frame <= numFrames; ++frame )
+    {
+        // timers, async updates and anything else queued on the message thread, until the frame is due
+        auto dispatchStart = Benchmark::getThreadCpuSeconds();
+        auto untilFrameMs = (wallStart * 1.0e-6) + (frame * frameMs) - (Benchmark::nowNanoseconds() * 1.0e-6);
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(juce::jmax(1, static_cast<int>(untilFrameMs)));
+        dispatchCpu += Benchmark::getThreadCpuSeconds() - dispatchStart;
+        
+        auto paintStart = Benchmark::getThreadCpuSeconds();
+        
+        for ( auto& instance : instances )
+        {
+            juce::Graphics g(canvas);
+            instance->editor->paintEntireComponent(g, false);
+        }
+        
+        paintCpu += Benchmark::getThreadCpuSeconds() - paintStart;
+    }
+    
+    auto wallSeconds = (Benchmark::nowNanoseconds() - wallStart) * 1.0e-9;
+    auto processCpu = Benchmark::getProcessCpuSeconds() - processCpuStart;
+    
+    host.stopThread(1000);
+    
+    auto perFrameMs = [numFrames](const double& totalSeconds) { return totalSeconds * 1000.0 / numFrames; };
+    
+    auto* sections = new juce::DynamicObject();
+    
+    for ( auto section = 0; section < FrameProfiler::NumSections; ++section )
+    {
+        auto id = static_cast<FrameProfiler::Section>(section);
+        if ( id == FrameProfiler::TimerInterval )
+            continue;
+        
+        // each editor has its own profiler, the section is their total
+        auto totalMs = 0.0;
+        
+        for ( auto& instance : instances )
+            totalMs += instance->editor->getProfiler().getStats(id).totalMs;
+        
+        sections->setProperty(FrameProfiler::getSectionName(id), perFrameMs(totalMs * 1.0e-3));
+    }
+    
+    auto* result = new juce::DynamicObject();
+    result->setProperty("instances",             numInstances);
+    result->setProperty("frames",                numFrames);
+    result->setProperty("rssBytes",              rssAfter);
+    result->setProperty("rssPerInstanceBytes",   (rssAfter - rssBefore) / numInstances);
+    
+    // of one core, so more than 100 means more than one core's worth
+    result->setProperty("cpuPercent",            100.0 * processCpu / wallSeconds);
+    result->setProperty("messageThreadMsPerFrame", perFrameMs(dispatchCpu + paintCpu));
+    result->setProperty("timersMsPerFrame",      perFrameMs(dispatchCpu));
+    result->setProperty("paintMsPerFrame",       perFrameMs(paintCpu));
+    result->setProperty("sectionsMsPerFrame",    juce::var(sections));
+    
+    result->setProperty("audioThreadCpuPercent", 100.0 * host.cpuSeconds / wallSeconds);
+    result->setProperty("processBlockUsPerInstance",
+                        host.numBlocks > 0 ? host.processNs * 1.0e-3 / (host.numBlocks * numInstances) : 0.0);
+    
+    // everything on the message thread in a frame has to fit in the frame
+    result->setProperty("messageThreadLoadPercent", 100.0 * perFrameMs(dispatchCpu + paintCpu) / frameMs);
+    
+    instances.clear();
+    
+    return juce::var(result);
+}
+
+}
+
+//==============================================================================
+void InstanceBenchmark::run(const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI gui;
+    
+    auto options = Benchmark::Options::parse(args, 5.0);
+    juce::Array<juce::var> results;
+    
+    for ( auto numInstances : getInstanceCounts(options.quick) )
+    {
+        Benchmark::log(juce::String(numInstances) + " instances");
+        results.add(runCase(numInstances, options.secondsPerCase));
+    }
+    
+    if ( !Benchmark::writeReport("instances", results, options) )
+        juce::ConsoleApplication::fail("couldn't write the report");
+}
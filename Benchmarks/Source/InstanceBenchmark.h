@@ -0,0 +1,32 @@
+/*
+  ==============================================================================
+
+    InstanceBenchmark.h
+    Created: 18 Oct 2026 10:37:25pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+What each extra instance costs.
+Opens N processor and editor pairs in one process (1, 8, 32 and 128),
+drives every processor with audio from a single realtime host thread, and
+runs the real message loop so every timer fires the way it would in a host.
+Each display frame every editor is also painted offscreen, standing in for
+the OS repaint.
+Reports resident memory per instance, total CPU, and message thread time
+per frame split into timers (with the editor timer callback and analysis
+update inside them) and paint (with the profiler's per-view sections),
+plus the audio thread's share.
+--seconds is how long each instance count runs for.
+*/
+namespace InstanceBenchmark
+{
+    void run(const juce::ArgumentList& args);
+}
@@ -0,0 +1,194 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "BenchmarkHarness.h"
+#include "DspKernels.h"
+#include "ReferenceChecks.h"
+#include <numeric>
+
+//==============================================================================
+/*
+Headless cost of the analysis code, per sample.
+Every kernel is swept over block sizes, channel counts and sample rates.
+Blocks are timed in batches of at least batchSamples so that tiny blocks
+aren't lost in timer resolution; ns/sample is per channel sample.
+The accuracy checks run first, and the exit code is non-zero if any fail.
+Usage: DspBenchmarks [--output results.json] [--filter name] [--seconds 0.1] [--quick] [--checks]
+--checks runs the accuracy checks without timing anything.
+*/
+namespace
+{
+
+constexpr int batchSamples = 4096;
+constexpr int maxInputBlocks = 64;
+constexpr int maxInputSamples = 65536;
+constexpr int minBatches = 16;
+
+std::vector<int> getBlockSizes(const bool& quick)
+{
+    if ( quick )
+        return { 1, 64, 512, 8192 };
+    
+    std::vector<int> sizes;
+    
+    for ( auto size = 1; size <= 8192; size *= 2 )
+        sizes.push_back(size);
+    
+    return sizes;
+}
+
+std::vector<int> getChannelCounts(const bool& quick)
+{
+    if ( quick )
+        return { 2 };
+    
+    return { 1, 2, 6, 16 };
+}
+
+std::vector<double> getSampleRates(const bool& quick)
+{
+    if ( quick )
+        return { 48000.0 };
+    
+    return { 44100.0, 48000.0, 96000.0, 192000.0 };
+}
+
+//==============================================================================
+// noise for main and reference, viewed as a rotating set of blocks so every
+// iteration reads different memory, like a host would hand over
+struct InputBlocks
+{
+    InputBlocks(const int& numChannels, const int& blockSize)
+    {
+        auto numBlocks = juce::jlimit(1, maxInputBlocks, maxInputSamples / blockSize);
+        
+        for ( auto stream = 0; stream < 2; ++stream )
+        {
+            storage[stream].setSize(numChannels, numBlocks * blockSize);
+            Benchmark::fillWithNoise(storage[stream], stream + 1);
+            
+            for ( auto block = 0; block < numBlocks; ++block )
+            {
+                views[stream].push_back(std::make_unique<juce::AudioBuffer<float>>(storage[stream].getArrayOfWritePointers(),
+                                                                                   numChannels,
+                                                                                   block * blockSize,
+                                                                                   blockSize));
+            }
+        }
+    }
+    
+    int getNumBlocks() const { return static_cast<int>(views[0].size()); }
+    const juce::AudioBuffer<float>& getMain(const int& index) const { return *views[0][index]; }
+    const juce::AudioBuffer<float>& getReference(const int& index) const { return *views[1][index]; }
+
+private:
+    juce::AudioBuffer<float> storage[2];
+    std::vector<std::unique_ptr<juce::AudioBuffer<float>>> views[2];
+};
+
+juce::var runCase(DspKernel& kernel, const KernelConfig& config, const double& secondsPerCase)
+{
+    InputBlocks input(config.numChannels, config.blockSize);
+    kernel.prepare(config);
+    
+    auto blocksPerBatch = juce::jmax(1, batchSamples / config.blockSize);
+    auto channelSamplesPerBatch = static_cast<double>(blocksPerBatch) * config.blockSize * config.numChannels;
+    auto nextBlock = 0;
+    
+    auto runBatch = [&]()
+    {
+        auto start = Benchmark::nowNanoseconds();
+        
+        for ( auto i = 0; i < blocksPerBatch; ++i )
+        {
+            kernel.process(input.getMain(nextBlock), input.getReference(nextBlock));
+            nextBlock = (nextBlock + 1) % input.getNumBlocks();
+        }
+        
+        return Benchmark::nowNanoseconds() - start;
+    };
+    
+    // warm up caches, branch predictors and the first frames of history
+    auto budgetNs = secondsPerCase * 1.0e9;
+    auto warmupEnd = Benchmark::nowNanoseconds() + (budgetNs * 0.1);
+    
+    while ( Benchmark::nowNanoseconds() < warmupEnd )
+        runBatch();
+    
+    std::vector<double> nsPerSample;
+    auto measureEnd = Benchmark::nowNanoseconds() + budgetNs;
+    
+    while ( Benchmark::nowNanoseconds() < measureEnd || static_cast<int>(nsPerSample.size()) < minBatches )
+        nsPerSample.push_back(runBatch() / channelSamplesPerBatch);
+    
+    auto mean = std::accumulate(nsPerSample.begin(), nsPerSample.end(), 0.0) / nsPerSample.size();
+    auto p50 = Benchmark::percentile(nsPerSample, 0.5);
+    auto p99 = Benchmark::percentile(nsPerSample, 0.99);
+    
+    auto* result = new juce::DynamicObject();
+    result->setProperty("kernel",      kernel.getName());
+    result->setProperty("sampleRate",  config.sampleRate);
+    result->setProperty("blockSize",   config.blockSize);
+    result->setProperty("numChannels", config.numChannels);
+    result->setProperty("batches",     static_cast<int>(nsPerSample.size()));
+    result->setProperty("nsPerSampleP50",  p50);
+    result->setProperty("nsPerSampleP99",  p99);
+    result->setProperty("nsPerSampleMin",  nsPerSample.front());
+    result->setProperty("nsPerSampleMean", mean);
+    result->setProperty("nsPerBlockP50",   p50 * config.blockSize * config.numChannels);
+    
+    // channel samples per second, and how many times faster than realtime one instance runs
+    result->setProperty("samplesPerSecond", 1.0e9 / p50);
+    result->setProperty("realtimeFactor",   1.0e9 / (p50 * config.numChannels * config.sampleRate));
+    result->setProperty("checksum",         kernel.getChecksum());
+    
+    return juce::var(result);
+}
+
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+    auto options = Benchmark::Options::parse(args, 0.1);
+    
+    // a kernel that got faster by getting the wrong answer isn't worth timing
+    auto checks = ReferenceChecks::run();
+    auto kernels = createDspKernels();
+    
+    if ( args.containsOption("--checks") )
+        kernels.clear();
+    
+    juce::Array<juce::var> results;
+    
+    for ( auto& kernel : kernels )
+    {
+        if ( !options.matches(kernel->getName()) )
+            continue;
+        
+        Benchmark::log(kernel->getName());
+        
+        for ( auto sampleRate : getSampleRates(options.quick) )
+        {
+            for ( auto numChannels : getChannelCounts(options.quick) )
+            {
+                for ( auto blockSize : getBlockSizes(options.quick) )
+                {
+                    KernelConfig config { sampleRate, blockSize, numChannels };
+                    results.add(runCase(*kernel, config, options.secondsPerCase));
+                }
+            }
+        }
+    }
+    
+    auto written = Benchmark::writeReport("dsp", results, options, checks);
+    
+    return written && ReferenceChecks::allPassed(checks) ? 0 : 1;
+}
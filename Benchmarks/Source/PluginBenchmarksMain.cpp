@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "RenderBenchmark.h"
+#include "StressBenchmark.h"
+#include "InstanceBenchmark.h"
+#include "SpscStress.h"
+
+//==============================================================================
+/*
+Benchmarks that need the whole plugin: processor, editor and all.
+Each suite is a command, e.g. PluginBenchmarks render --output render.json
+*/
+int main (int argc, char* argv[])
+{
+    juce::ConsoleApplication app;
+    
+    app.addHelpCommand("--help|-h", "Usage: PluginBenchmarks <suite> [--output file.json] [--filter text] [--seconds s] [--quick]", true);
+    
+    app.addCommand({ "render",
+                     "render [--output file.json] [--filter layout] [--seconds s] [--quick]",
+                     "Times offscreen rendering of the editor and each of its components",
+                     "",
+                     RenderBenchmark::run });
+    
+    app.addCommand({ "stress",
+                     "stress [--output file.json] [--seconds s] [--quick]",
+                     "Drives the processor like an unfriendly host while the editor runs at 8x",
+                     "",
+                     StressBenchmark::run });
+    
+    app.addCommand({ "instances",
+                     "instances [--output file.json] [--seconds s] [--quick]",
+                     "Measures CPU, memory and message thread time for 1 to 128 open instances",
+                     "",
+                     InstanceBenchmark::run });
+    
+    app.addCommand({ "spsc",
+                     "spsc [--output file.json] [--seconds s]",
+                     "Checks CircularBuffer and Averager readers never see torn values while another thread writes",
+                     "",
+                     SpscStress::run });
+    
+    return app.findAndRunCommand(argc, argv);
+}
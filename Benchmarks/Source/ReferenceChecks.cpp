@@ -0,0 +1,1100 @@
+/*
+  ==============================================================================
+
+    ReferenceChecks.cpp
+    Created: 18 Oct 2026 10:14:51pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "ReferenceChecks.h"
+#include "../../Source/Averager.h"
+#include "../../Source/CircularBuffer.h"
+#include "../../Source/CorrelationAnalyzer.h"
+#include "../../Source/FrameAnalyzer.h"
+#include "../../Source/LevelPyramid.h"
+#include "../../Source/LoudnessAnalyzer.h"
+#include "../../Source/MeterBallistics.h"
+#include "../../Source/OverDetector.h"
+#include "../../Source/PlayPositionCache.h"
+#include "../../Source/SignalGenerator.h"
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <numeric>
+
+namespace
+{
+
+//==============================================================================
+// the worst difference seen over every case of one check
+struct Result
+{
+    juce::String check;
+    juce::String unit;
+    double tolerance = 0.0;
+    
+    double maxError = 0.0;
+    int cases = 0;
+    
+    void compare(const double& actual, const double& expected)
+    {
+        ++cases;
+        
+        // a NaN or inf where a number was expected always fails
+        auto error = actual == expected ? 0.0 : std::abs(actual - expected);
+        if ( !std::isfinite(error) )
+            error = std::numeric_limits<double>::max();
+        
+        maxError = juce::jmax(maxError, error);
+    }
+    
+    bool passed() const { return cases > 0 && maxError <= tolerance; }
+    
+    juce::var toVar() const
+    {
+        auto* result = new juce::DynamicObject();
+        result->setProperty("check",     check);
+        result->setProperty("cases",     cases);
+        result->setProperty("maxError",  maxError);
+        result->setProperty("tolerance", tolerance);
+        result->setProperty("unit",      unit);
+        result->setProperty("passed",    passed());
+        
+        return juce::var(result);
+    }
+};
+
+float nextSample(juce::Random& random)
+{
+    return (random.nextFloat() * 2.f) - 1.f;
+}
+
+//==============================================================================
+// every value written must come back out of read(), oldest first
+Result checkCircularBuffer()
+{
+    Result result { "circularBuffer", "value", 0.0 };
+    juce::Random random(1);
+    
+    for ( size_t size : { 1, 7, 256, 4800 } )
+    {
+        CircularBuffer<float> buffer(size, 0.f);
+        std::deque<float> reference(size, 0.f);
+        std::vector<float> snapshot(size);
+        
+        auto numWrites = (size * 3) + 5; // wraps a few times and stops part way round
+        
+        for ( size_t i = 0; i < numWrites; ++i )
+        {
+            auto value = nextSample(random);
+            buffer.write(value);
+            reference.pop_front();
+            reference.push_back(value);
+            
+            if ( i % 97 != 0 && i != numWrites - 1 )
+                continue;
+            
+            buffer.read(snapshot.data());
+            
+            for ( size_t k = 0; k < size; ++k )
+                result.compare(snapshot[k], reference[k]);
+            
+            result.compare(buffer.getNewest(), reference.back());
+        }
+    }
+    
+    return result;
+}
+
+//==============================================================================
+// min, max and mean of stretches of every length up to the whole of level 0,
+// put together from buckets of every level, against the values themselves.
+// Means of means in float round a little, hence the tolerance.
+Result checkLevelPyramid()
+{
+    Result result { "levelPyramid", "dB", 1.0e-4 };
+    juce::Random random(9);
+    
+    LevelPyramid pyramid;
+    std::vector<float> values;
+    
+    // enough to fill the top level's first buckets several times over
+    for ( juce::uint64 i = 0; i < LevelPyramid::bucketsPerLevel * 8; ++i )
+    {
+        auto value = Globals::negInf() + random.nextFloat() * (Globals::maxDb() - Globals::negInf());
+        pyramid.push(value);
+        values.push_back(value);
+    }
+    
+    auto numValues = static_cast<juce::int64>(values.size());
+    
+    for ( auto i = 0; i < 2000; ++i )
+    {
+        auto end = numValues - random.nextInt(100);
+        auto start = end - 1 - random.nextInt(static_cast<int>(LevelPyramid::bucketsPerLevel) - 100);
+        
+        auto minimum = values[static_cast<size_t>(start)];
+        auto maximum = minimum;
+        auto sum = 0.0;
+        
+        for ( auto k = start; k < end; ++k )
+        {
+            minimum = juce::jmin(minimum, values[static_cast<size_t>(k)]);
+            maximum = juce::jmax(maximum, values[static_cast<size_t>(k)]);
+            sum += values[static_cast<size_t>(k)];
+        }
+        
+        auto bucket = pyramid.get(start, end);
+        result.compare(bucket.min, minimum);
+        result.compare(bucket.max, maximum);
+        result.compare(bucket.mean, sum / static_cast<double>(end - start));
+    }
+    
+    return result;
+}
+
+//==============================================================================
+// the running mean against the window summed from scratch in double, over enough adds
+// of values far enough from zero for any rounding left behind in the sum to build up.
+// The tolerance is about one float step at the size of the values.
+Result checkAverager()
+{
+    Result result { "averager", "value", 1.0e-5 };
+    juce::Random random(2);
+    
+    for ( size_t size : { 1, 6, 512, 4800 } )
+    {
+        // a window that starts full of something other than zero
+        Averager<float> averager(size, 0.75f);
+        std::deque<double> reference(size, 0.75);
+        
+        result.compare(averager.getAverage(), 0.75);
+        
+        for ( auto i = 0; i < 2000000; ++i )
+        {
+            auto value = 100.f + nextSample(random);
+            averager.add(value);
+            reference.pop_front();
+            reference.push_back(value);
+            
+            if ( i % 499 != 0 )
+                continue;
+            
+            auto mean = std::accumulate(reference.begin(), reference.end(), 0.0) / reference.size();
+            result.compare(averager.getAverage(), mean);
+        }
+    }
+    
+    return result;
+}
+
+//==============================================================================
+/*
+One channel of a meter the way it was written before the ballistics were
+vectorised: a window of levels summed from scratch every frame, and a
+falling tick per quantity. State is kept in float like the meters, so ties
+between a level and a held tick resolve the same way. MeterBallistics has to
+produce the same lanes.
+*/
+struct ReferenceHold
+{
+    void capture(const float& input, const juce::int64& nowMs)
+    {
+        if ( input > value )
+        {
+            peakTime = nowMs;
+            value = input;
+            multiplier = 1.0;
+        }
+    }
+    
+    void decay(const juce::int64& nowMs, const juce::int64& holdTimeMs, const float& decayPerFrame)
+    {
+        if ( nowMs - peakTime <= holdTimeMs )
+            return;
+        
+        value = juce::jlimit(Globals::negInf(), Globals::maxDb(), value - (decayPerFrame * multiplier));
+        multiplier = value == Globals::negInf() ? 1.f : multiplier * 1.04f;
+    }
+    
+    float value = Globals::negInf();
+    float multiplier = 1.f;
+    juce::int64 peakTime = 0;
+};
+
+struct ReferenceChannel
+{
+    ReferenceChannel(const size_t& averagerFrames, const juce::int64& startMs)
+        : window(averagerFrames, Globals::negInf()),
+          heldTime(startMs)
+    {
+        instantTick.peakTime = startMs;
+        averageTick.peakTime = startMs;
+    }
+    
+    void update(const float& newLevel, const juce::int64& nowMs, const float& threshold)
+    {
+        level = newLevel;
+        window.pop_front();
+        window.push_back(newLevel);
+        average = static_cast<float>(std::accumulate(window.begin(), window.end(), 0.0) / window.size());
+        
+        instantTick.capture(level, nowMs);
+        averageTick.capture(average, nowMs);
+        
+        if ( level > threshold )
+        {
+            heldTime = nowMs;
+            heldValue = juce::jmax(heldValue, level);
+        }
+    }
+    
+    void advance(const juce::int64& nowMs, const juce::int64& holdTimeMs, const float& decayPerFrame)
+    {
+        instantTick.decay(nowMs, holdTimeMs, decayPerFrame);
+        averageTick.decay(nowMs, holdTimeMs, decayPerFrame);
+        
+        if ( nowMs - heldTime > 2000 )
+            heldValue = Globals::negInf();
+    }
+    
+    std::deque<double> window;
+    float level = Globals::negInf();
+    float average = Globals::negInf();
+    float heldValue = Globals::negInf();
+    juce::int64 heldTime = 0;
+    
+    ReferenceHold instantTick;
+    ReferenceHold averageTick;
+};
+
+Result checkMeterBallistics()
+{
+    Result result { "meterBallistics", "dB", 1.0e-3 };
+    juce::Random random(3);
+    
+    // averager id -> frames, as MeterBallistics::resizeAverager
+    const std::pair<int, size_t> averagers[] { { 1, 4 }, { 3, 20 }, { 5, 80 } };
+    const auto threshold = -6.f;
+    const juce::int64 holdTimeMs = 500;                             // hold id 2
+    const auto decayPerFrame = 12.f / MeterBallistics::frameRateHz; // decay id 3
+    const auto frameMs = 1000 / MeterBallistics::frameRateHz;
+    
+    for ( auto numChannels : { 1, 2, Globals::maxChannels } )
+    {
+        for ( auto& averager : averagers )
+        {
+            MeterBallistics ballistics;
+            auto startMs = juce::Time::currentTimeMillis();
+            
+            ballistics.setNumChannels(numChannels);
+            ballistics.setThreshold(threshold);
+            ballistics.setDecayRate(3);
+            ballistics.setTickHoldTime(2);
+            ballistics.resizeAverager(averager.first);
+            
+            std::vector<ReferenceChannel> reference(numChannels, ReferenceChannel(averager.second, startMs));
+            
+            // every channel does its own random walk between the floor and the top of the scale
+            std::vector<float> levels(numChannels, -30.f);
+            
+            for ( auto frame = 1; frame <= 4000; ++frame )
+            {
+                auto nowMs = startMs + (frame * frameMs);
+                
+                for ( auto& level : levels )
+                    level = juce::jlimit(Globals::negInf(), Globals::maxDb(), level + (nextSample(random) * 3.f));
+                
+                ballistics.update(levels.data(), nowMs);
+                ballistics.advance(nowMs);
+                
+                for ( auto ch = 0; ch < numChannels; ++ch )
+                {
+                    auto& channel = reference[ch];
+                    channel.update(levels[ch], nowMs, threshold);
+                    channel.advance(nowMs, holdTimeMs, decayPerFrame);
+                    
+                    result.compare(ballistics.getLevel(ch),        channel.level);
+                    result.compare(ballistics.getAverage(ch),      channel.average);
+                    result.compare(ballistics.getInstantTick(ch),  channel.instantTick.value);
+                    result.compare(ballistics.getAverageTick(ch),  channel.averageTick.value);
+                    result.compare(ballistics.getTextValue(ch),    channel.level > threshold ? channel.heldValue : channel.level);
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+//==============================================================================
+/*
+FrameAnalyzer's single pass against a per frame, per channel two pass
+measurement in double, on content chosen to catch lane and frame boundary
+mistakes: noise, a tone, isolated impulses, a full scale square and silence,
+fed in block sizes that straddle frames every way they can.
+*/
+void fillFrameTestSignal(juce::AudioBuffer<float>& main, juce::AudioBuffer<float>& reference, const double& sampleRate)
+{
+    juce::Random random(4);
+    auto numSamples = main.getNumSamples();
+    
+    for ( auto i = 0; i < numSamples; ++i )
+    {
+        auto t = i / sampleRate;
+        
+        main.setSample(0, i, nextSample(random) * 0.5f);
+        main.setSample(1, i, static_cast<float>(0.25 * std::sin(juce::MathConstants<double>::twoPi * 997.0 * t)));
+        main.setSample(2, i, i % 16301 == 5000 ? (i % 2 == 0 ? 0.9f : -0.95f) : 0.f);
+        main.setSample(3, i, std::fmod(t * 50.0, 1.0) < 0.5 ? 1.f : -1.f);
+        
+        reference.setSample(0, i, nextSample(random) * 0.1f);
+        reference.setSample(1, i, 0.f);
+    }
+}
+
+Result checkFrameLevels()
+{
+    Result result { "frameAnalyzer.levels", "dB", 1.0e-3 };
+    const int blockSizes[] { 1, 7, 441, 1000, 4096, 13, 512 };
+    
+    for ( auto sampleRate : { 44100.0, 48000.0, 96000.0 } )
+    {
+        auto frameLength = juce::roundToInt(sampleRate / MeterBallistics::frameRateHz);
+        auto numFrames = 100;
+        auto numSamples = (numFrames * frameLength) + 123; // the last frame is never finished
+        
+        juce::AudioBuffer<float> main(4, numSamples);
+        juce::AudioBuffer<float> reference(2, numSamples);
+        fillFrameTestSignal(main, reference, sampleRate);
+        
+        FrameAnalyzer analyzer;
+        AnalysisHistory history;
+        analyzer.prepare(sampleRate, 4096);
+        
+        auto start = 0;
+        
+        for ( auto block = 0; start < numSamples; ++block )
+        {
+            auto count = juce::jmin(blockSizes[block % juce::numElementsInArray(blockSizes)], numSamples - start);
+            
+            juce::AudioBuffer<float> mainBlock(main.getArrayOfWritePointers(), main.getNumChannels(), start, count);
+            juce::AudioBuffer<float> referenceBlock(reference.getArrayOfWritePointers(), reference.getNumChannels(), start, count);
+            analyzer.process(mainBlock, referenceBlock, history, false);
+            
+            start += count;
+        }
+        
+        result.compare(static_cast<double>(history.getNumWritten()), numFrames);
+        
+        const juce::AudioBuffer<float>* streams[NumStreams] { &main, &reference };
+        AnalysisFrame frame;
+        
+        for ( auto index = 0; index < numFrames && history.read(static_cast<juce::uint64>(index), frame); ++index )
+        {
+            for ( auto stream = 0; stream < NumStreams; ++stream )
+            {
+                for ( auto ch = 0; ch < streams[stream]->getNumChannels(); ++ch )
+                {
+                    auto* samples = streams[stream]->getReadPointer(ch, index * frameLength);
+                    auto peak = 0.0;
+                    auto sumOfSquares = 0.0;
+                    
+                    for ( auto i = 0; i < frameLength; ++i )
+                        peak = juce::jmax(peak, std::abs(static_cast<double>(samples[i])));
+                    
+                    for ( auto i = 0; i < frameLength; ++i )
+                        sumOfSquares += static_cast<double>(samples[i]) * samples[i];
+                    
+                    auto lane = AnalysisFrame::getLane(static_cast<Stream>(stream), ch);
+                    auto floor = static_cast<double>(Globals::negInf());
+                    
+                    result.compare(frame.peakDb[lane], juce::Decibels::gainToDecibels(peak, floor));
+                    result.compare(frame.rmsDb[lane], juce::Decibels::gainToDecibels(std::sqrt(sumOfSquares / frameLength), floor));
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+//==============================================================================
+// signals whose correlation is known exactly: identical sides, inverted sides,
+// and independent noise, which should average out close to zero
+Result checkCorrelation(const SignalGenerator::Type& type, const double& expected, const double& tolerance)
+{
+    Result result { juce::String("correlation.") + SignalGenerator::getTypeName(type), "correlation", tolerance };
+    
+    const auto sampleRate = 48000.0;
+    const auto blockSize = 512;
+    
+    SignalGenerator generator;
+    generator.prepare(sampleRate, blockSize);
+    generator.setType(type);
+    
+    CorrelationAnalyzer analyzer;
+    analyzer.prepare(sampleRate, blockSize, blockSize);
+    
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    auto numBlocks = juce::roundToInt(sampleRate * 4.0 / blockSize);
+    
+    for ( auto block = 0; block < numBlocks; ++block )
+    {
+        generator.render(buffer);
+        analyzer.process(buffer.getReadPointer(0), buffer.getReadPointer(1), blockSize);
+        
+        // the first second fills the averagers
+        if ( block * blockSize >= sampleRate )
+            result.compare(analyzer.getAverageCorrelation(), expected);
+    }
+    
+    return result;
+}
+
+//==============================================================================
+/*
+CorrelationAnalyzer averages the signs of L * R a group at a time. Averaging
+every sign, read at the end of every frame as FrameAnalyzer reads it, has
+to give the same, for partly correlated noise with a low tone on top, at
+every rate up to 192kHz and with short blocks as well as long ones.
+*/
+Result checkCorrelationGrouping()
+{
+    Result result { "correlation.grouped", "correlation", 1.0e-5 };
+    
+    for ( auto sampleRate : { 44100.0, 48000.0, 96000.0, 192000.0 } )
+    {
+        for ( auto blockSize : { 64, 512 } )
+        {
+            auto frameLength = juce::roundToInt(sampleRate / MeterBallistics::frameRateHz);
+            
+            CorrelationAnalyzer analyzer;
+            analyzer.prepare(sampleRate, blockSize, frameLength);
+        
+            Averager<float> instant(static_cast<size_t>(blockSize), 0.f);
+            Averager<float> averaged(static_cast<size_t>(blockSize * 6), 0.f);
+        
+            juce::Random random(5);
+            std::vector<float> left(static_cast<size_t>(frameLength)), right(static_cast<size_t>(frameLength));
+            auto numFrames = juce::roundToInt(MeterBallistics::frameRateHz * 4.0);
+        
+            for ( auto f = 0; f < numFrames; ++f )
+            {
+                for ( auto i = 0; i < frameLength; ++i )
+                {
+                    auto time = (f * frameLength + i) / sampleRate;
+                    auto tone = 0.3f * static_cast<float>(std::sin(juce::MathConstants<double>::twoPi * 60.0 * time));
+                    auto shared = nextSample(random) * 0.3f;
+                
+                    left[static_cast<size_t>(i)] = shared + tone;
+                    right[static_cast<size_t>(i)] = (0.6f * shared) + (0.8f * nextSample(random) * 0.3f) + tone;
+                
+                    auto product = left[static_cast<size_t>(i)] * right[static_cast<size_t>(i)];
+                    auto sign = product > 0.f ? 1.f : (product < 0.f ? -1.f : 0.f);
+                    instant.add(sign);
+                    averaged.add(sign);
+                }
+            
+                analyzer.process(left.data(), right.data(), frameLength);
+            
+                // the first second fills the averagers
+                if ( f >= MeterBallistics::frameRateHz )
+                {
+                    result.compare(analyzer.getInstantCorrelation(), instant.getAverage());
+                    result.compare(analyzer.getAverageCorrelation(), averaged.getAverage());
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+//==============================================================================
+/*
+Level compliance vectors, synthesised with the test signal generator and
+measured through the same frame analysis as the meters.
+EBU Tech 3341 cases 1 and 2 are a stereo 1kHz sine at -23dBFS and -33dBFS
+(-23 and -33 LUFS); ATSC A/85 uses the same tone at -24dBFS. At the sample
+level that means a peak of exactly the stated level and an RMS 3.01dB
+below it, on both channels, at any sample rate.
+*/
+Result checkToneLevels()
+{
+    Result result { "compliance.toneLevels", "dB", 0.01 };
+    
+    struct Vector { SignalGenerator::Type type; float level; double peakDb; };
+    const Vector vectors[]
+    {
+        { SignalGenerator::EbuTone,  SignalGenerator::defaultLevel, -23.0 }, // Tech 3341 case 1
+        { SignalGenerator::Sine,     -33.f,                         -33.0 }, // Tech 3341 case 2
+        { SignalGenerator::AtscTone, SignalGenerator::defaultLevel, -24.0 },
+        { SignalGenerator::Sine,     -18.f,                         -18.0 }, // alignment level
+    };
+    
+    const auto sineCrestDb = 20.0 * std::log10(std::sqrt(2.0));
+    const auto blockSize = 480;
+    
+    for ( auto sampleRate : { 44100.0, 48000.0, 96000.0 } )
+    {
+        for ( auto& vector : vectors )
+        {
+            SignalGenerator generator;
+            generator.prepare(sampleRate, blockSize);
+            generator.setType(vector.type);
+            generator.setLevel(vector.level);
+            
+            FrameAnalyzer analyzer;
+            AnalysisHistory history;
+            analyzer.prepare(sampleRate, blockSize);
+            
+            juce::AudioBuffer<float> main(2, blockSize);
+            juce::AudioBuffer<float> noReference;
+            
+            // 10 seconds, well inside the history
+            auto numBlocks = juce::roundToInt(sampleRate * 10.0 / blockSize);
+            
+            for ( auto block = 0; block < numBlocks; ++block )
+            {
+                generator.render(main);
+                analyzer.process(main, noReference, history, false);
+            }
+            
+            AnalysisFrame frame;
+            
+            for ( juce::uint64 index = history.getOldestAvailable(); history.read(index, frame); ++index )
+            {
+                for ( auto ch = 0; ch < 2; ++ch )
+                {
+                    result.compare(frame.peakDb[ch], vector.peakDb);
+                    result.compare(frame.rmsDb[ch], vector.peakDb - sineCrestDb);
+                }
+            }
+        }
+    }
+    
+    return result;
+}
+
+//==============================================================================
+// the K-weighting filters against the 48kHz coefficients printed in BS.1770
+Result checkKWeighting()
+{
+    Result result { "loudness.kWeighting", "coefficient", 1.0e-8 };
+    
+    auto stages = LoudnessAnalyzer::designKWeighting(48000.0);
+    
+    const double shelf[] { 1.53512485958697, -2.69169618940638, 1.19839281085285, -1.69065929318241, 0.73248077421585 };
+    const double highPass[] { 1.0, -2.0, 1.0, -1.99004745483398, 0.99007225036621 };
+    
+    auto compare = [&result](const LoudnessAnalyzer::Biquad& actual, const double* expected)
+    {
+        result.compare(actual.b0, expected[0]);
+        result.compare(actual.b1, expected[1]);
+        result.compare(actual.b2, expected[2]);
+        result.compare(actual.a1, expected[3]);
+        result.compare(actual.a2, expected[4]);
+    };
+    
+    compare(stages[0], shelf);
+    compare(stages[1], highPass);
+    
+    return result;
+}
+
+/*
+Feeds a stereo 1kHz sine through the loudness analyzer, one level per
+segment, with the phase carried across segments as the EBU files do.
+*/
+struct ToneSegment { double dbfs; double seconds; };
+
+LoudnessAnalyzer measureToneSegments(const std::vector<ToneSegment>& segments, const double& sampleRate)
+{
+    LoudnessAnalyzer analyzer;
+    analyzer.prepare(sampleRate, juce::AudioChannelSet::stereo());
+    
+    const auto blockSize = 480;
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    auto phase = 0.0;
+    auto increment = juce::MathConstants<double>::twoPi * 1000.0 / sampleRate;
+    
+    for ( auto& segment : segments )
+    {
+        auto gain = juce::Decibels::decibelsToGain(segment.dbfs, -1000.0);
+        auto remaining = juce::roundToInt(segment.seconds * sampleRate);
+        
+        while ( remaining > 0 )
+        {
+            auto count = juce::jmin(remaining, blockSize);
+            
+            for ( auto i = 0; i < count; ++i )
+            {
+                auto sample = static_cast<float>(gain * std::sin(phase));
+                buffer.setSample(0, i, sample);
+                buffer.setSample(1, i, sample);
+                phase = std::fmod(phase + increment, juce::MathConstants<double>::twoPi);
+            }
+            
+            analyzer.process(buffer.getArrayOfReadPointers(), 2, count);
+            remaining -= count;
+        }
+    }
+    
+    return analyzer;
+}
+
+/*
+Integrated loudness for EBU Tech 3341 cases 1 to 5, which must read within
+0.1 LU of the stated value.
+*/
+Result checkIntegratedLoudness()
+{
+    Result result { "compliance.integratedLoudness", "LU", 0.1 };
+    
+    struct Vector { std::vector<ToneSegment> segments; double lufs; };
+    const std::vector<Vector> vectors
+    {
+        { { { -23.0, 20.0 } }, -23.0 },                                                                     // case 1
+        { { { -33.0, 20.0 } }, -33.0 },                                                                     // case 2
+        { { { -36.0, 10.0 }, { -23.0, 60.0 }, { -36.0, 10.0 } }, -23.0 },                                   // case 3
+        { { { -72.0, 10.0 }, { -36.0, 10.0 }, { -23.0, 60.0 }, { -36.0, 10.0 }, { -72.0, 10.0 } }, -23.0 }, // case 4
+        { { { -26.0, 20.0 }, { -20.0, 20.1 }, { -26.0, 20.0 } }, -23.0 },                                   // case 5
+    };
+    
+    for ( auto sampleRate : { 44100.0, 48000.0 } )
+    {
+        for ( auto& vector : vectors )
+            result.compare(measureToneSegments(vector.segments, sampleRate).getIntegratedLufs(), vector.lufs);
+    }
+    
+    return result;
+}
+
+/*
+Loudness range for EBU Tech 3342 cases 1 to 4, which allows 1 LU either way.
+The tones are steady, so this implementation should land much closer.
+*/
+Result checkLoudnessRange()
+{
+    Result result { "compliance.loudnessRange", "LU", 1.0 };
+    
+    struct Vector { std::vector<ToneSegment> segments; double range; };
+    const std::vector<Vector> vectors
+    {
+        { { { -20.0, 20.0 }, { -30.0, 20.0 } }, 10.0 },                                                    // case 1
+        { { { -20.0, 20.0 }, { -15.0, 20.0 } }, 5.0 },                                                     // case 2
+        { { { -40.0, 20.0 }, { -20.0, 20.0 } }, 20.0 },                                                    // case 3
+        { { { -50.0, 20.0 }, { -35.0, 20.0 }, { -20.0, 20.0 }, { -35.0, 20.0 }, { -50.0, 20.0 } }, 15.0 }, // case 4
+    };
+    
+    for ( auto sampleRate : { 44100.0, 48000.0 } )
+    {
+        for ( auto& vector : vectors )
+            result.compare(measureToneSegments(vector.segments, sampleRate).getLoudnessRange(), vector.range);
+    }
+    
+    return result;
+}
+
+/*
+BS.1770 channel weights for the layouts a host or a WAV channel mask gives,
+which must match the standard's table exactly: no weight for the LFE, 1.41
+for surrounds between 60 and 120 degrees. 7.1 comes both in JUCE's order and
+as the usual WAV mask, where Ls/Rs are the rears and the sides come last.
+*/
+Result checkChannelWeights()
+{
+    Result result { "compliance.channelWeights", "", 0.0 };
+    
+    using Set = juce::AudioChannelSet;
+    
+    // FL FR FC LFE BL BR SL SR
+    auto wavSevenOne = Set::channelSetWithChannels({ Set::left, Set::right, Set::centre, Set::LFE,
+                                                     Set::leftSurround, Set::rightSurround,
+                                                     Set::leftSurroundSide, Set::rightSurroundSide });
+    
+    struct Vector { Set layout; std::vector<float> weights; };
+    const std::vector<Vector> vectors
+    {
+        { Set::stereo(),              { 1.f, 1.f } },
+        { Set::create5point1(),       { 1.f, 1.f, 1.f, 0.f, 1.41f, 1.41f } },
+        { Set::create7point1(),       { 1.f, 1.f, 1.f, 0.f, 1.41f, 1.41f, 1.f, 1.f } },
+        { Set::create7point1point4(), { 1.f, 1.f, 1.f, 0.f, 1.41f, 1.41f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f } },
+        { Set::discreteChannels(6),   { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f } },
+        { wavSevenOne,                { 1.f, 1.f, 1.f, 0.f, 1.f, 1.f, 1.41f, 1.41f } },
+    };
+    
+    for ( auto& vector : vectors )
+    {
+        auto weights = LoudnessAnalyzer::getChannelWeights(vector.layout);
+        
+        for ( size_t ch = 0; ch < vector.weights.size(); ++ch )
+            result.compare(weights[ch], vector.weights[ch]);
+    }
+    
+    return result;
+}
+
+//==============================================================================
+/*
+A region summed up by PlayPositionCache from the values it kept per slot,
+against a LoudnessAnalyzer fed the same audio and cleared where the region
+starts. Over a straight pass they must take the same gating blocks, so the
+check uses noise that changes level more often than the loudness steps, and
+a pass that starts part way into the timeline, as playing from anywhere but
+the start does. The cache keeps loudness to 0.01LU, hence the tolerance.
+*/
+Result checkPlayPositionRegion()
+{
+    Result result { "playPosition.region", "LU", 0.01 };
+    
+    const auto blockSize = 512;
+    
+    for ( auto sampleRate : { 44100.0, 48000.0 } )
+    {
+        AnalysisHistory history;
+        FrameAnalyzer analyzer;
+        analyzer.prepare(sampleRate, blockSize, true);
+        
+        PlayPositionCache cache(history);
+        cache.prepare(sampleRate);
+        cache.start();
+        
+        LoudnessAnalyzer reference;
+        reference.prepare(sampleRate, juce::AudioChannelSet::stereo());
+        
+        const auto slotLength = cache.getSlotLength();
+        const auto hostStart = juce::int64(sampleRate * 12.3);
+        const auto numSamples = juce::int64(slotLength) * juce::roundToInt(60.0 * MeterBallistics::frameRateHz);
+        
+        // at a frame boundary, once short-term has a full window behind it
+        const auto clearAt = juce::int64(slotLength) * juce::roundToInt(4.0 * MeterBallistics::frameRateHz);
+        
+        // a little under the history, so the cache's writer never falls behind
+        const auto samplesPerChunk = juce::int64(slotLength) * static_cast<juce::int64>(AnalysisHistory::capacity - 100);
+        
+        juce::Random random(2);
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::AudioBuffer<float> noReference;
+        auto levelLength = juce::roundToInt(sampleRate * 0.33);
+        auto gain = 0.f;
+        
+        for ( juce::int64 processed = 0; processed < numSamples; )
+        {
+            // blocks end where the reference is cleared
+            auto count = static_cast<int>(juce::jmin(juce::int64(blockSize), numSamples - processed));
+            if ( processed < clearAt )
+                count = static_cast<int>(juce::jmin(juce::int64(count), clearAt - processed));
+            
+            buffer.setSize(2, count, false, false, true);
+            
+            for ( auto i = 0; i < count; ++i )
+            {
+                if ( (processed + i) % levelLength == 0 )
+                    gain = juce::Decibels::decibelsToGain(-40.f + 30.f * random.nextFloat());
+                
+                buffer.setSample(0, i, gain * nextSample(random));
+                buffer.setSample(1, i, gain * nextSample(random));
+            }
+            
+            analyzer.process(buffer, noReference, history, false, hostStart + processed);
+            reference.process(buffer.getArrayOfReadPointers(), 2, count);
+            processed += count;
+            
+            if ( processed == clearAt )
+                reference.clearMeasurements();
+            
+            // wait for the cache to store the last whole frame
+            if ( processed % samplesPerChunk < count || processed == numSamples )
+            {
+                auto lastCentre = hostStart + (processed / slotLength) * slotLength - (slotLength / 2);
+                SessionTimeline::Record record;
+                
+                for ( auto waited = 0; waited < 5000 && cache.read(lastCentre / slotLength, &record, 1) == 0; ++waited )
+                    juce::Thread::sleep(1);
+            }
+        }
+        
+        // from the slot the first frame after clearAt was stored in, to past the end
+        auto regionStart = ((hostStart + clearAt + (slotLength / 2)) / slotLength) * slotLength;
+        auto region = cache.getRegion(regionStart, hostStart + numSamples + slotLength);
+        
+        result.compare(region.integratedLufs, reference.getIntegratedLufs());
+        result.compare(region.loudnessRange, reference.getLoudnessRange());
+    }
+    
+    return result;
+}
+
+//==============================================================================
+/*
+Runs a signal through an OverDetector in blocks of blockSize, pulling events
+after every block as the message thread would, and returns those of one
+kind, in channel order and then in time. The signal should end with enough
+silence for the last event to be released.
+*/
+std::vector<OverEvent> detectOvers(const juce::AudioBuffer<float>& signal,
+                                   const double& sampleRate,
+                                   const int& blockSize,
+                                   const float& peakThresholdDb,
+                                   const OverEvent::Kind& kind)
+{
+    OverDetector detector;
+    detector.prepare(sampleRate);
+    detector.setPeakThreshold(peakThresholdDb);
+    
+    juce::AudioBuffer<float> block(signal.getNumChannels(), blockSize);
+    std::vector<OverEvent> events;
+    OverEvent event;
+    
+    for ( auto start = 0; start < signal.getNumSamples(); start += blockSize )
+    {
+        auto count = juce::jmin(blockSize, signal.getNumSamples() - start);
+        block.setSize(signal.getNumChannels(), count, false, false, true);
+        
+        for ( auto ch = 0; ch < signal.getNumChannels(); ++ch )
+            block.copyFrom(ch, 0, signal, ch, start, count);
+        
+        detector.process(block, -1);
+        
+        while ( detector.pull(event) )
+        {
+            if ( event.kind == kind )
+                events.push_back(event);
+        }
+    }
+    
+    std::stable_sort(events.begin(), events.end(), [](const OverEvent& a, const OverEvent& b) { return a.channel < b.channel; });
+    
+    return events;
+}
+
+/*
+A sine at a quarter of the sample rate with a 45 degree phase offset has
+every sample at 0.707 of its peak, so its true peak is 3.01dB above its
+sample peak. The true peak over has to report the sine's real peak in dBTP,
+and the sample peak over the level of the samples, at every rate.
+*/
+Result checkTruePeak()
+{
+    Result result { "overs.truePeak", "dB", 0.05 };
+    
+    const auto blockSize = 480;
+    const auto sampleCrestDb = 20.0 * std::log10(std::sqrt(2.0));
+    
+    for ( auto sampleRate : { 44100.0, 48000.0, 96000.0 } )
+    {
+        for ( auto truePeakDb : { -0.5, 0.0, 3.0 } )
+        {
+            auto gain = juce::Decibels::decibelsToGain(truePeakDb);
+            auto numSamples = juce::roundToInt(sampleRate);
+            auto fadeLength = juce::roundToInt(sampleRate * 0.05);
+            
+            // faded in and out so the edges don't ring over the sine's own peak, then silence
+            juce::AudioBuffer<float> signal(2, numSamples + fadeLength);
+            signal.clear();
+            
+            for ( auto i = 0; i < numSamples; ++i )
+            {
+                auto fade = juce::jmin(1.0, juce::jmin(i, numSamples - 1 - i) / static_cast<double>(fadeLength));
+                auto envelope = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::pi * fade);
+                auto phase = (juce::MathConstants<double>::halfPi * i) + (juce::MathConstants<double>::pi / 4.0);
+                auto sample = static_cast<float>(gain * envelope * std::sin(phase));
+                
+                signal.setSample(0, i, sample);
+                signal.setSample(1, i, sample);
+            }
+            
+            // one event per channel, for the whole sine
+            auto truePeaks = detectOvers(signal, sampleRate, blockSize, 0.f, OverEvent::TruePeakOver);
+            auto samplePeaks = detectOvers(signal, sampleRate, blockSize, static_cast<float>(truePeakDb - 6.0), OverEvent::PeakOver);
+            
+            result.compare(truePeaks.size(), 2.0);
+            result.compare(samplePeaks.size(), 2.0);
+            
+            for ( auto& event : truePeaks )
+                result.compare(event.maxDb, truePeakDb);
+            
+            for ( auto& event : samplePeaks )
+                result.compare(event.maxDb, truePeakDb - sampleCrestDb);
+        }
+    }
+    
+    return result;
+}
+
+/*
+Runs at full scale, from too short to count to longer than any block, each
+starting a sample before a 64 sample boundary and so crossing it, fed in
+blocks from 1 sample up. Every run of clipRunLength or more has to come out
+as one clip with its exact start and length, on either polarity.
+*/
+Result checkClipRuns()
+{
+    Result result { "overs.clipRuns", "samples", 0.0 };
+    
+    const auto sampleRate = 48000.0;
+    const auto spacing = 64 * 32;
+    const int lengths[] { 1, 2, 3, 4, 63, 65, 700, 5000 };
+    
+    std::vector<int> starts;
+    auto start = spacing - 1;
+    
+    for ( auto length : lengths )
+    {
+        starts.push_back(start);
+        start += spacing + 64 * (length / 64);
+    }
+    
+    juce::AudioBuffer<float> signal(2, start + spacing);
+    signal.clear();
+    
+    std::vector<std::pair<juce::int64, juce::int64>> expected;
+    
+    for ( auto run = 0; run < juce::numElementsInArray(lengths); ++run )
+    {
+        for ( auto i = 0; i < lengths[run]; ++i )
+        {
+            signal.setSample(0, starts[run] + i, 1.f);
+            signal.setSample(1, starts[run] + i, -1.f);
+        }
+        
+        if ( lengths[run] >= OverDetector::clipRunLength )
+            expected.push_back({ starts[run], lengths[run] });
+    }
+    
+    for ( auto blockSize : { 1, 2, 3, 37, 64, 480, 4096 } )
+    {
+        auto events = detectOvers(signal, sampleRate, blockSize, 0.f, OverEvent::ClipRun);
+        result.compare(events.size(), expected.size() * 2.0);
+        
+        for ( size_t i = 0; i < juce::jmin(events.size(), expected.size() * 2); ++i )
+        {
+            auto& run = expected[i % expected.size()];
+            result.compare(events[i].channel, i < expected.size() ? 0.0 : 1.0);
+            result.compare(events[i].startSample, run.first);
+            result.compare(events[i].length, run.second);
+        }
+    }
+    
+    return result;
+}
+
+/*
+Short bursts over the peak threshold with gaps either side of the release
+time. A gap of up to releaseSeconds keeps the over going, one sample more
+ends it, so the events have to start at the first burst of each group and
+end at the last, wherever the block boundaries fall.
+*/
+Result checkOverRelease()
+{
+    Result result { "overs.release", "samples", 0.0 };
+    
+    const auto burstLength = 5;
+    
+    for ( auto sampleRate : { 44100.0, 48000.0 } )
+    {
+        auto release = juce::roundToInt(sampleRate * OverDetector::releaseSeconds);
+        const int gaps[] { release - 1, release, release + 1, 1, release, 3 * release, release + 1 };
+        
+        auto numGaps = juce::numElementsInArray(gaps);
+        juce::AudioBuffer<float> signal(1, (burstLength + 3 * release) * (numGaps + 2));
+        signal.clear();
+        
+        // start and length of each group of bursts no more than the release apart
+        std::vector<std::pair<juce::int64, juce::int64>> expected;
+        auto start = release;
+        
+        for ( auto burst = 0; burst <= numGaps; ++burst )
+        {
+            for ( auto i = 0; i < burstLength; ++i )
+                signal.setSample(0, start + i, 0.5f);
+            
+            auto end = start + burstLength;
+            
+            if ( burst > 0 && gaps[burst - 1] <= release )
+                expected.back().second = end - expected.back().first;
+            else
+                expected.push_back({ start, burstLength });
+            
+            if ( burst < numGaps )
+                start = end + gaps[burst];
+        }
+        
+        for ( auto blockSize : { 1, 64, 480, 4096 } )
+        {
+            auto events = detectOvers(signal, sampleRate, blockSize, -12.f, OverEvent::PeakOver);
+            result.compare(events.size(), expected.size());
+            
+            for ( size_t i = 0; i < juce::jmin(events.size(), expected.size()); ++i )
+            {
+                result.compare(events[i].startSample, expected[i].first);
+                result.compare(events[i].length, expected[i].second);
+            }
+        }
+    }
+    
+    return result;
+}
+
+}
+
+//==============================================================================
+namespace ReferenceChecks
+{
+
+juce::Array<juce::var> run()
+{
+    std::vector<std::function<Result()>> checks
+    {
+        checkCircularBuffer,
+        checkLevelPyramid,
+        checkAverager,
+        checkMeterBallistics,
+        checkFrameLevels,
+        [] { return checkCorrelation(SignalGenerator::Sine,          1.0, 1.0e-3); },
+        [] { return checkCorrelation(SignalGenerator::PhaseInverted, -1.0, 1.0e-3); },
+        [] { return checkCorrelation(SignalGenerator::Decorrelated,  0.0, 0.1); },
+        checkCorrelationGrouping,
+        checkToneLevels,
+        checkKWeighting,
+        checkIntegratedLoudness,
+        checkLoudnessRange,
+        checkChannelWeights,
+        checkTruePeak,
+        checkClipRuns,
+        checkOverRelease,
+        checkPlayPositionRegion,
+    };
+    
+    juce::Array<juce::var> results;
+    
+    for ( auto& check : checks )
+    {
+        auto result = check();
+        
+        Benchmark::log(result.check + (result.passed() ? " ok" : " FAILED")
+                       + ", max error " + juce::String(result.maxError) + " " + result.unit
+                       + " (tolerance " + juce::String(result.tolerance) + ")");
+        
+        results.add(result.toVar());
+    }
+    
+    return results;
+}
+
+bool allPassed(const juce::Array<juce::var>& results)
+{
+    for ( auto& result : results )
+    {
+        if ( !static_cast<bool>(result["passed"]) )
+            return false;
+    }
+    
+    return true;
+}
+
+}
@@ -0,0 +1,34 @@
+/*
+  ==============================================================================
+
+    ReferenceChecks.h
+    Created: 18 Oct 2026 10:14:51pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "BenchmarkHarness.h"
+
+//==============================================================================
+/*
+Accuracy checks for the analysis code, run before anything is timed.
+Each check drives the code the plugin ships with generated signals and
+compares it against a plain scalar reference (double precision, no running
+totals, one channel at a time) or against the value a standard says a test
+signal must read. Every check has an explicit tolerance, so a faster
+version of a kernel that changes the numbers shows up as a failure here
+rather than as a slightly different meter.
+Each result is { check, cases, maxError, tolerance, unit, passed }.
+*/
+namespace ReferenceChecks
+{
+
+juce::Array<juce::var> run();
+
+bool allPassed(const juce::Array<juce::var>& results);
+
+}
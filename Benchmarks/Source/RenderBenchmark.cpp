@@ -0,0 +1,242 @@
+/*
+  ==============================================================================
+
+    RenderBenchmark.cpp
+    Created: 18 Oct 2026 9:31:08pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "RenderBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "ScriptedSignal.h"
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/PluginEditor.h"
+#include <map>
+
+#if defined(__GNUC__)
+ #include <cxxabi.h>
+#endif
+
+namespace
+{
+
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 512;
+constexpr int warmupFrames = MeterBallistics::frameRateHz;
+
+struct Layout
+{
+    juce::String name;
+    juce::AudioChannelSet channels;
+};
+
+std::vector<Layout> getLayouts(const bool& quick)
+{
+    if ( quick )
+        return { { "stereo", juce::AudioChannelSet::stereo() } };
+    
+    return
+    {
+        { "stereo", juce::AudioChannelSet::stereo() },
+        { "5.1",    juce::AudioChannelSet::create5point1() },
+        { "7.1.4",  juce::AudioChannelSet::create7point1point4() }
+    };
+}
+
+std::vector<float> getScales(const bool& quick)
+{
+    if ( quick )
+        return { 1.f };
+    
+    return { 1.f, 1.5f, 2.f };
+}
+
+juce::String getComponentName(const juce::Component& component)
+{
+    if ( component.getName().isNotEmpty() )
+        return component.getName();
+   
+   #if defined(__GNUC__)
+    auto status = 0;
+    std::unique_ptr<char, decltype(&std::free)> demangled(abi::__cxa_demangle(typeid(component).name(), nullptr, nullptr, &status),
+                                                          &std::free);
+    if ( status == 0 )
+        return demangled.get();
+   #endif
+   
+    return typeid(component).name();
+}
+
+//==============================================================================
+struct Timings
+{
+    juce::String name;
+    std::vector<double> frameMs;
+    
+    juce::var summarise(const Layout& layout, const juce::Rectangle<int>& size, const float& scale)
+    {
+        auto mean = std::accumulate(frameMs.begin(), frameMs.end(), 0.0) / juce::jmax(size_t(1), frameMs.size());
+        
+        auto* result = new juce::DynamicObject();
+        result->setProperty("layout",    layout.name);
+        result->setProperty("width",     size.getWidth());
+        result->setProperty("height",    size.getHeight());
+        result->setProperty("scale",     scale);
+        result->setProperty("component", name);
+        result->setProperty("frames",    static_cast<int>(frameMs.size()));
+        result->setProperty("meanMs",    mean);
+        result->setProperty("p50Ms",     Benchmark::percentile(frameMs, 0.5));
+        result->setProperty("p99Ms",     Benchmark::percentile(frameMs, 0.99));
+        result->setProperty("maxMs",     frameMs.empty() ? 0.0 : frameMs.back());
+        
+        return juce::var(result);
+    }
+};
+
+struct RenderTarget
+{
+    RenderTarget(const juce::String& name, juce::Component& c, const float& scale)
+        : component(c),
+          image(juce::Image::ARGB,
+                juce::jmax(1, juce::roundToInt(c.getWidth() * scale)),
+                juce::jmax(1, juce::roundToInt(c.getHeight() * scale)),
+                true)
+    {
+        timings.name = name;
+    }
+    
+    void render(const float& scale, const bool& record)
+    {
+        auto start = Benchmark::nowNanoseconds();
+        
+        {
+            juce::Graphics g(image);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            component.paintEntireComponent(g, false);
+        }
+        
+        if ( record )
+            timings.frameMs.push_back((Benchmark::nowNanoseconds() - start) * 1.0e-6);
+    }
+    
+    juce::Component& component;
+    juce::Image image;
+    Timings timings;
+};
+
+// the editor itself, then every visible child, with repeated types numbered
+std::vector<std::unique_ptr<RenderTarget>> createTargets(juce::Component& editor, const float& scale)
+{
+    std::vector<std::unique_ptr<RenderTarget>> targets;
+    targets.push_back(std::make_unique<RenderTarget>("editor", editor, scale));
+    
+    std::map<juce::String, int> count;
+    
+    for ( auto* child : editor.getChildren() )
+    {
+        if ( !child->isVisible() || child->getBounds().isEmpty() )
+            continue;
+        
+        auto name = getComponentName(*child);
+        auto index = ++count[name];
+        
+        if ( index > 1 )
+            name << " #" << index;
+        
+        targets.push_back(std::make_unique<RenderTarget>(name, *child, scale));
+    }
+    
+    return targets;
+}
+
+void runCase(const Layout& layout, const float& scale, const int& numFrames, juce::Array<juce::var>& results)
+{
+    PFMProject10AudioProcessor processor;
+    
+    auto buses = processor.getBusesLayout();
+    buses.inputBuses.getReference(0) = layout.channels;
+    buses.outputBuses.getReference(0) = layout.channels;
+    
+    if ( !processor.setBusesLayout(buses) )
+    {
+        Benchmark::log("  " + layout.name + " isn't supported, skipped");
+        return;
+    }
+    
+    processor.prepareToPlay(sampleRate, blockSize);
+    
+    PFMProject10AudioProcessorEditor editor(processor);
+    auto targets = createTargets(editor, scale);
+    
+    Timings timerCallback { "timerCallback", {} };
+    
+    ScriptedSignal signal;
+    signal.prepare(sampleRate);
+    
+    auto numChannels = juce::jmax(processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+    juce::AudioBuffer<float> block(numChannels, blockSize);
+    juce::MidiBuffer midi;
+    
+    auto samplesPerFrame = juce::roundToInt(sampleRate / MeterBallistics::frameRateHz);
+    
+    for ( auto frame = -warmupFrames; frame < numFrames; ++frame )
+    {
+        auto record = frame >= 0;
+        
+        // one display frame of audio, in host sized blocks
+        for ( auto remaining = samplesPerFrame; remaining > 0; )
+        {
+            auto numSamples = juce::jmin(blockSize, remaining);
+            block.setSize(numChannels, numSamples, false, false, true);
+            signal.render(block);
+            processor.processBlock(block, midi);
+            remaining -= numSamples;
+        }
+        
+        auto start = Benchmark::nowNanoseconds();
+        editor.timerCallback();
+        
+        if ( record )
+            timerCallback.frameMs.push_back((Benchmark::nowNanoseconds() - start) * 1.0e-6);
+        
+        for ( auto& target : targets )
+            target->render(scale, record);
+    }
+    
+    processor.releaseResources();
+    
+    results.add(timerCallback.summarise(layout, editor.getLocalBounds(), scale));
+    
+    for ( auto& target : targets )
+        results.add(target->timings.summarise(layout, target->component.getLocalBounds(), scale));
+}
+
+}
+
+//==============================================================================
+void RenderBenchmark::run(const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI gui;
+    
+    auto options = Benchmark::Options::parse(args, 6.0);
+    auto numFrames = juce::jmax(1, juce::roundToInt(options.secondsPerCase * MeterBallistics::frameRateHz));
+    
+    juce::Array<juce::var> results;
+    
+    for ( const auto& layout : getLayouts(options.quick) )
+    {
+        if ( !options.matches(layout.name) )
+            continue;
+        
+        for ( auto scale : getScales(options.quick) )
+        {
+            Benchmark::log(layout.name + " @" + juce::String(scale) + "x");
+            runCase(layout, scale, numFrames, results);
+        }
+    }
+    
+    if ( !Benchmark::writeReport("render", results, options) )
+        juce::ConsoleApplication::fail("couldn't write the report");
+}
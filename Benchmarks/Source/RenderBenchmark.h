@@ -0,0 +1,29 @@
+/*
+  ==============================================================================
+
+    RenderBenchmark.h
+    Created: 18 Oct 2026 9:31:08pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+Offscreen cost of drawing the editor.
+Builds a processor and editor for a few channel layouts (which set the
+editor size), feeds the processor a ScriptedSignal one display frame at a
+time, runs the editor's timer callback and then renders the whole editor
+and each of its visible children into an Image with paintEntireComponent,
+at several scale factors. Every frame is timed; the report has p50/p99
+per component, so rendering changes can be compared without a display.
+--seconds is the length of scripted signal rendered per case.
+*/
+namespace RenderBenchmark
+{
+    void run(const juce::ArgumentList& args);
+}
@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    ScriptedSignal.cpp
+    Created: 18 Oct 2026 9:24:50pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "ScriptedSignal.h"
+
+//==============================================================================
+void ScriptedSignal::prepare(const double& newSampleRate)
+{
+    sampleRate = newSampleRate;
+    position = 0;
+    phase = 0.0;
+    phaseIncrement = juce::MathConstants<double>::twoPi * 220.0 / sampleRate;
+    random.setSeed(1);
+}
+
+void ScriptedSignal::render(juce::AudioBuffer<float>& buffer, const int& startSample, const int& numSamples)
+{
+    constexpr auto sweepSeconds = 4.0;
+    constexpr auto rotationSeconds = 7.0;
+    constexpr auto burstEverySeconds = 2.0;
+    constexpr auto burstLengthSeconds = 0.05;
+    
+    auto numChannels = buffer.getNumChannels();
+    
+    for ( auto i = startSample; i < startSample + numSamples; ++i )
+    {
+        auto seconds = static_cast<double>(position) / sampleRate;
+        
+        // triangle between -48 and 0 dB
+        auto sweep = std::fmod(seconds, sweepSeconds) / sweepSeconds;
+        auto levelDb = -48.0 + (96.0 * juce::jmin(sweep, 1.0 - sweep));
+        auto gain = juce::Decibels::decibelsToGain(levelDb);
+        
+        auto rotation = juce::MathConstants<double>::twoPi * seconds / rotationSeconds;
+        auto isBurst = std::fmod(seconds, burstEverySeconds) < burstLengthSeconds;
+        auto noise = isBurst ? (random.nextFloat() * 2.f) - 1.f : 0.f;
+        
+        auto left = static_cast<float>(gain * std::sin(phase)) + noise;
+        auto right = static_cast<float>(gain * std::sin(phase + rotation)) + noise;
+        
+        for ( auto ch = 0; ch < numChannels; ++ch )
+        {
+            auto pairGain = 1.f / static_cast<float>(1 + (ch / 2));
+            buffer.setSample(ch, i, pairGain * (ch % 2 == 0 ? left : right));
+        }
+        
+        phase += phaseIncrement;
+        if ( phase > juce::MathConstants<double>::twoPi )
+            phase -= juce::MathConstants<double>::twoPi;
+        
+        ++position;
+    }
+}
@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    ScriptedSignal.h
+    Created: 18 Oct 2026 9:24:50pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+A repeatable signal that keeps every part of the editor busy.
+A stereo tone whose level sweeps between -48 and 0 dB every four seconds,
+with the right channel slowly rotating in phase against the left so the
+goniometer and correlation meter move through their whole range, and a
+short noise burst every two seconds so peak and RMS pull apart.
+Channels beyond the first two repeat the pair at slightly lower levels.
+*/
+struct ScriptedSignal
+{
+    void prepare(const double& sampleRate);
+    
+    // overwrites every channel of buffer from startSample
+    void render(juce::AudioBuffer<float>& buffer, const int& startSample, const int& numSamples);
+    void render(juce::AudioBuffer<float>& buffer) { render(buffer, 0, buffer.getNumSamples()); }
+
+private:
+    double sampleRate = 48000.0;
+    juce::int64 position = 0;
+    
+    double phase = 0.0;
+    double phaseIncrement = 0.0;
+    
+    juce::Random random { 1 };
+};
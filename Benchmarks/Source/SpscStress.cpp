@@ -0,0 +1,245 @@
+/*
+  ==============================================================================
+
+    SpscStress.cpp
+    Created: 18 Oct 2026 10:47:26pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "SpscStress.h"
+#include "BenchmarkHarness.h"
+#include "../../Source/Averager.h"
+#include "../../Source/CircularBuffer.h"
+
+namespace
+{
+
+constexpr size_t historySize = 776;                    // a histogram column per value, at the default size
+constexpr size_t averagerSize = 3072;                  // CorrelationAnalyzer's long window at 512 sample blocks
+constexpr juce::uint32 counterMask = (1u << 24) - 1;   // a float holds every integer up to here exactly
+constexpr int maxBurst = 64;
+constexpr int maxPauseNs = 20000;
+
+// spins rather than sleeps, so most pauses are shorter than one read
+void pause(juce::Random& random)
+{
+    auto until = Benchmark::nowNanoseconds() + random.nextInt(maxPauseNs);
+    
+    while ( Benchmark::nowNanoseconds() < until ) {}
+}
+
+//==============================================================================
+// writes 1, 2, 3... (wrapping at counterMask) into the history
+struct HistoryWriter : juce::Thread
+{
+    explicit HistoryWriter(CircularBuffer<float>& b) : juce::Thread("history writer"), buffer(b) { }
+    
+    void run() override
+    {
+        juce::Random random(1);
+        
+        while ( !threadShouldExit() )
+        {
+            for ( auto i = random.nextInt(maxBurst) + 1; i > 0; --i )
+            {
+                counter = (counter + 1) & counterMask;
+                buffer.write(static_cast<float>(counter));
+                ++writes;
+            }
+            
+            pause(random);
+        }
+    }
+    
+    CircularBuffer<float>& buffer;
+    juce::uint32 counter = 0;
+    juce::int64 writes = 0; // read once the thread has stopped
+};
+
+// one unbroken run of the counter, after whatever is left of the initial zeros
+bool isUnbroken(const std::vector<float>& history)
+{
+    size_t k = 0;
+    
+    while ( k + 1 < history.size() && history[k] == 0.f && history[k + 1] == 0.f )
+        ++k;
+    
+    for ( ; k + 1 < history.size(); ++k )
+    {
+        auto step = static_cast<juce::uint32>(history[k + 1]) - static_cast<juce::uint32>(history[k]);
+        
+        if ( (step & counterMask) != 1 )
+            return false;
+    }
+    
+    return true;
+}
+
+juce::var runHistory(const double& seconds)
+{
+    CircularBuffer<float> buffer(historySize, 0.f);
+    std::vector<float> history(historySize);
+    
+    HistoryWriter writer(buffer);
+    writer.startThread();
+    
+    juce::int64 reads = 0;
+    juce::int64 torn = 0;
+    juce::int64 wentBackwards = 0;
+    juce::uint32 lastNewest = 0;
+    
+    auto end = Benchmark::nowNanoseconds() + (seconds * 1.0e9);
+    
+    while ( Benchmark::nowNanoseconds() < end )
+    {
+        buffer.read(history.data());
+        ++reads;
+        
+        if ( !isUnbroken(history) )
+            ++torn;
+        
+        // the newest value on its own can only move forwards
+        auto newest = static_cast<juce::uint32>(buffer.getNewest());
+        
+        if ( ((newest - lastNewest) & counterMask) > (counterMask / 2) )
+            ++wentBackwards;
+        
+        lastNewest = newest;
+    }
+    
+    writer.stopThread(1000);
+    
+    auto* result = new juce::DynamicObject();
+    result->setProperty("structure",     "CircularBuffer");
+    result->setProperty("seconds",       seconds);
+    result->setProperty("writes",        writer.writes);
+    result->setProperty("reads",         reads);
+    result->setProperty("tornReads",     torn);
+    result->setProperty("wentBackwards", wentBackwards);
+    result->setProperty("invalid",       torn + wentBackwards);
+    
+    return juce::var(result);
+}
+
+//==============================================================================
+/*
+Adds phases of averagerSize identical values, a different value per phase,
+announcing each phase before its first add. While phase n is under way the
+window holds only values from phases n - 1 and n, so the mean must lie
+between the two.
+*/
+float getPhaseValue(const juce::uint64& phase)
+{
+    return static_cast<float>(phase % 64);
+}
+
+struct AveragerWriter : juce::Thread
+{
+    explicit AveragerWriter(Averager<float>& a) : juce::Thread("averager writer"), averager(a) { }
+    
+    void run() override
+    {
+        juce::Random random(2);
+        
+        while ( !threadShouldExit() )
+        {
+            auto next = phase.load(std::memory_order_relaxed) + 1;
+            phase.store(next, std::memory_order_release);
+            
+            auto value = getPhaseValue(next);
+            size_t added = 0;
+            
+            while ( added < averagerSize && !threadShouldExit() )
+            {
+                for ( auto i = random.nextInt(maxBurst) + 1; i > 0 && added < averagerSize; --i )
+                {
+                    averager.add(value);
+                    ++added;
+                    ++adds;
+                }
+                
+                pause(random);
+            }
+        }
+    }
+    
+    Averager<float>& averager;
+    std::atomic<juce::uint64> phase { 0 };
+    juce::int64 adds = 0; // read once the thread has stopped
+};
+
+juce::var runAverager(const double& seconds)
+{
+    Averager<float> averager(averagerSize, getPhaseValue(0));
+    
+    AveragerWriter writer(averager);
+    writer.startThread();
+    
+    juce::int64 reads = 0;
+    juce::int64 outOfRange = 0;
+    
+    auto end = Benchmark::nowNanoseconds() + (seconds * 1.0e9);
+    
+    while ( Benchmark::nowNanoseconds() < end )
+    {
+        auto before = writer.phase.load(std::memory_order_acquire);
+        auto average = averager.getAverage();
+        auto after = writer.phase.load(std::memory_order_acquire);
+        
+        // the mean may belong to either side of a phase change, so only judge it inside one
+        if ( before != after || before == 0 )
+            continue;
+        
+        ++reads;
+        
+        auto previous = getPhaseValue(before - 1);
+        auto current = getPhaseValue(before);
+        
+        if ( average < juce::jmin(previous, current) - 1.0e-3f || average > juce::jmax(previous, current) + 1.0e-3f )
+            ++outOfRange;
+    }
+    
+    writer.stopThread(1000);
+    
+    auto* result = new juce::DynamicObject();
+    result->setProperty("structure",  "Averager");
+    result->setProperty("seconds",    seconds);
+    result->setProperty("writes",     writer.adds);
+    result->setProperty("reads",      reads);
+    result->setProperty("outOfRange", outOfRange);
+    result->setProperty("invalid",    outOfRange);
+    
+    return juce::var(result);
+}
+
+}
+
+//==============================================================================
+void SpscStress::run(const juce::ArgumentList& args)
+{
+    auto options = Benchmark::Options::parse(args, 10.0);
+    
+    juce::Array<juce::var> results;
+    juce::int64 invalid = 0;
+    
+    for ( auto& runCase : { runHistory, runAverager } )
+    {
+        auto result = runCase(options.secondsPerCase);
+        invalid += static_cast<juce::int64>(result["invalid"]);
+        
+        Benchmark::log(result["structure"].toString() + ": " + result["reads"].toString() + " reads, "
+                       + result["invalid"].toString() + " invalid");
+        
+        results.add(result);
+    }
+    
+    auto written = Benchmark::writeReport("spsc", results, options);
+    
+    if ( invalid > 0 )
+        juce::ConsoleApplication::fail("a reader saw a torn or impossible value");
+    
+    if ( !written )
+        juce::ConsoleApplication::fail("couldn't write the report");
+}
@@ -0,0 +1,32 @@
+/*
+  ==============================================================================
+
+    SpscStress.h
+    Created: 18 Oct 2026 10:47:26pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+Hammers CircularBuffer and Averager with one writer thread and one reader
+thread, far harder than the plugin ever does.
+The writer writes a counter into the buffer, and adds runs of known values to
+the averager, in bursts with random pauses between them so reads overlap
+writes at every point. The reader checks that every history it copies out is
+one unbroken run of the counter, and that every mean it sees lies between the
+value being added and the one before it.
+Reports reads, writes and any torn or impossible values, and exits with an
+error if there were any.
+Build the ThreadSanitizer configuration to have races reported too.
+--seconds is the length of the run for each structure.
+*/
+namespace SpscStress
+{
+    void run(const juce::ArgumentList& args);
+}
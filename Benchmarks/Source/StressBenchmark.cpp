@@ -0,0 +1,315 @@
+/*
+  ==============================================================================
+
+    StressBenchmark.cpp
+    Created: 18 Oct 2026 9:58:42pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "StressBenchmark.h"
+#include "BenchmarkHarness.h"
+#include "ScriptedSignal.h"
+#include "../../Source/SignalGenerator.h"
+#include "../../Source/PluginProcessor.h"
+#include "../../Source/PluginEditor.h"
+
+namespace
+{
+
+constexpr double speed = 8.0;
+constexpr int maxBlockSize = 16384;
+
+constexpr std::array<double, 8> sampleRates { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0, 352800.0, 384000.0 };
+constexpr std::array<int, 12> announcedBlockSizes { 16, 32, 64, 128, 256, 441, 480, 512, 1000, 1024, 2048, 4096 };
+
+struct RateStats
+{
+    int blocks = 0;
+    int prepares = 0;
+    std::vector<double> blockUs;
+    double worstLoad = 0.0; // processBlock time over the block's duration
+};
+
+//==============================================================================
+// prepares and feeds the processor from its own thread, paced at speed x realtime
+struct HostThread : juce::Thread
+{
+    HostThread(PFMProject10AudioProcessor& p, const double& seconds)
+        : juce::Thread("hostile host"), processor(p), simulatedSeconds(seconds)
+    {
+        buffer.setSize(processor.getTotalNumInputChannels(), maxBlockSize);
+        
+        for ( auto& stats : statsPerRate )
+            stats.blockUs.reserve(1 << 16);
+    }
+    
+    void run() override
+    {
+        auto wallStart = Benchmark::nowNanoseconds();
+        auto simulatedNs = 0.0;
+        
+        while ( simulatedNs < simulatedSeconds * 1.0e9 && !threadShouldExit() )
+        {
+            auto rateIndex = random.nextInt(static_cast<int>(sampleRates.size()));
+            auto sampleRate = sampleRates[rateIndex];
+            auto announced = announcedBlockSizes[random.nextInt(static_cast<int>(announcedBlockSizes.size()))];
+            auto& stats = statsPerRate[rateIndex];
+            
+            // straight from the audio thread, with the editor running
+            processor.prepareToPlay(sampleRate, announced);
+            signal.prepare(sampleRate);
+            ++stats.prepares;
+            
+            // the scripted signal when the generator is Off, otherwise one of the test signals
+            generator.prepare(sampleRate, announced);
+            generator.setType(static_cast<SignalGenerator::Type>(random.nextInt(SignalGenerator::NumTypes)));
+            
+            auto segmentNs = simulatedNs + (random.nextFloat() * 2.5e9 + 0.5e9);
+            
+            while ( simulatedNs < segmentNs && !threadShouldExit() )
+            {
+                auto numSamples = pickBlockSize(announced);
+                buffer.setSize(buffer.getNumChannels(), numSamples, false, false, true);
+                
+                if ( generator.getType() == SignalGenerator::Off )
+                    signal.render(buffer);
+                else
+                    generator.render(buffer);
+                
+                auto injected = inject();
+                auto start = Benchmark::nowNanoseconds();
+                processor.processBlock(buffer, midi);
+                auto elapsed = Benchmark::nowNanoseconds() - start;
+                
+                if ( !injected && !isFinite(buffer) )
+                    ++nonFiniteOutputs;
+                
+                auto blockNs = 1.0e9 * numSamples / sampleRate;
+                
+                ++stats.blocks;
+                stats.blockUs.push_back(elapsed * 1.0e-3);
+                
+                if ( numSamples > 0 )
+                    stats.worstLoad = juce::jmax(stats.worstLoad, elapsed / blockNs);
+                
+                simulatedNs += blockNs;
+                pace(wallStart, simulatedNs);
+            }
+        }
+    }
+    
+    std::array<RateStats, sampleRates.size()> statsPerRate;
+    int injectedBlocks = 0;
+    int nonFiniteOutputs = 0;
+
+private:
+    int pickBlockSize(const int& announced)
+    {
+        auto choice = random.nextInt(100);
+        
+        if ( choice < 70 )
+            return announced;
+        
+        // shorter than announced, usually odd
+        if ( choice < 80 )
+            return 1 + random.nextInt(announced);
+        
+        // up to four times what was announced
+        if ( choice < 90 )
+            return juce::jmin(maxBlockSize, announced + random.nextInt(announced * 3));
+        
+        return choice < 95 ? 1 : 0;
+    }
+    
+    // returns true if a NaN or inf was written into the block
+    bool inject()
+    {
+        if ( buffer.getNumSamples() == 0 || random.nextInt(100) >= 4 )
+            return false;
+        
+        const float values[] { std::numeric_limits<float>::quiet_NaN(),
+                               std::numeric_limits<float>::infinity(),
+                               -std::numeric_limits<float>::infinity() };
+        
+        buffer.setSample(random.nextInt(buffer.getNumChannels()),
+                         random.nextInt(buffer.getNumSamples()),
+                         values[random.nextInt(3)]);
+        ++injectedBlocks;
+        return true;
+    }
+    
+    static bool isFinite(const juce::AudioBuffer<float>& b)
+    {
+        for ( auto ch = 0; ch < b.getNumChannels(); ++ch )
+        {
+            auto* samples = b.getReadPointer(ch);
+            
+            for ( auto i = 0; i < b.getNumSamples(); ++i )
+            {
+                if ( !std::isfinite(samples[i]) )
+                    return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    void pace(const double& wallStart, const double& simulatedNs)
+    {
+        auto targetNs = wallStart + (simulatedNs / speed);
+        auto aheadMs = (targetNs - Benchmark::nowNanoseconds()) * 1.0e-6;
+        
+        if ( aheadMs >= 1.0 )
+            juce::Thread::sleep(static_cast<int>(aheadMs));
+    }
+    
+    PFMProject10AudioProcessor& processor;
+    double simulatedSeconds;
+    
+    juce::AudioBuffer<float> buffer;
+    juce::MidiBuffer midi;
+    ScriptedSignal signal;
+    SignalGenerator generator;
+    juce::Random random { 36 };
+};
+
+//==============================================================================
+// what the editor would show; counts anything that isn't a number or is out of range
+struct MeterCheck
+{
+    void check(const PFMProject10AudioProcessor& processor)
+    {
+        const auto& meters = processor.analysisState.meters;
+        
+        for ( const auto* ballistics : { &meters.rms, &meters.peak } )
+        {
+            for ( auto ch = 0; ch < ballistics->getNumChannels(); ++ch )
+            {
+                countIfBad(ballistics->getLevel(ch));
+                countIfBad(ballistics->getAverage(ch));
+                countIfBad(ballistics->getInstantTick(ch));
+                countIfBad(ballistics->getAverageTick(ch));
+            }
+        }
+        
+        const auto& frame = processor.analysisState.getLatestFrame();
+        
+        for ( auto stream = 0; stream < NumStreams; ++stream )
+        {
+            for ( auto correlation : { frame.instantCorrelation[stream], frame.averageCorrelation[stream] } )
+            {
+                countIfBad(correlation);
+                
+                if ( std::abs(correlation) > 1.001f )
+                    ++correlationOutOfRange;
+            }
+        }
+        
+        if ( frame.timeMs < lastFrameTime )
+            ++framesOutOfOrder;
+        
+        lastFrameTime = frame.timeMs;
+    }
+    
+    int nonFiniteValues = 0;
+    int correlationOutOfRange = 0;
+    int framesOutOfOrder = 0;
+
+private:
+    void countIfBad(const float& value)
+    {
+        if ( !std::isfinite(value) )
+            ++nonFiniteValues;
+    }
+    
+    juce::int64 lastFrameTime = 0;
+};
+
+}
+
+//==============================================================================
+void StressBenchmark::run(const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI gui;
+    
+    auto options = Benchmark::Options::parse(args, 60.0);
+    
+    PFMProject10AudioProcessor processor;
+    processor.prepareToPlay(48000.0, 512);
+    
+    PFMProject10AudioProcessorEditor editor(processor);
+    HostThread host(processor, options.secondsPerCase);
+    MeterCheck meterCheck;
+    std::vector<double> timerUs;
+    
+    Benchmark::log("simulating " + juce::String(options.secondsPerCase) + "s at " + juce::String(speed) + "x");
+    host.startThread();
+    
+    auto timerIntervalNs = 1.0e9 / (MeterBallistics::frameRateHz * speed);
+    auto nextTick = Benchmark::nowNanoseconds();
+    
+    while ( host.isThreadRunning() )
+    {
+        auto start = Benchmark::nowNanoseconds();
+        editor.timerCallback();
+        timerUs.push_back((Benchmark::nowNanoseconds() - start) * 1.0e-3);
+        
+        meterCheck.check(processor);
+        
+        nextTick += timerIntervalNs;
+        auto aheadMs = (nextTick - Benchmark::nowNanoseconds()) * 1.0e-6;
+        
+        if ( aheadMs >= 1.0 )
+            juce::Thread::sleep(static_cast<int>(aheadMs));
+    }
+    
+    juce::Array<juce::var> results;
+    auto worstLoad = 0.0;
+    
+    for ( size_t i = 0; i < sampleRates.size(); ++i )
+    {
+        auto& stats = host.statsPerRate[i];
+        if ( stats.blocks == 0 )
+            continue;
+        
+        worstLoad = juce::jmax(worstLoad, stats.worstLoad);
+        
+        auto* result = new juce::DynamicObject();
+        result->setProperty("sampleRate",       sampleRates[i]);
+        result->setProperty("prepares",         stats.prepares);
+        result->setProperty("blocks",           stats.blocks);
+        result->setProperty("processBlockP50Us", Benchmark::percentile(stats.blockUs, 0.5));
+        result->setProperty("processBlockP99Us", Benchmark::percentile(stats.blockUs, 0.99));
+        result->setProperty("processBlockMaxUs", stats.blockUs.back());
+        result->setProperty("worstLoadPercent",  stats.worstLoad * 100.0);
+        results.add(juce::var(result));
+    }
+    
+    auto droppedFrames = static_cast<juce::int64>(processor.analysisState.getNumDroppedFrames());
+    
+    auto* summary = new juce::DynamicObject();
+    summary->setProperty("sampleRate",            "all");
+    summary->setProperty("simulatedSeconds",      options.secondsPerCase);
+    summary->setProperty("speed",                 speed);
+    summary->setProperty("worstLoadPercent",      worstLoad * 100.0);
+    summary->setProperty("timerCallbacks",        static_cast<int>(timerUs.size()));
+    summary->setProperty("timerCallbackP99Us",    Benchmark::percentile(timerUs, 0.99));
+    summary->setProperty("timerCallbackMaxUs",    timerUs.empty() ? 0.0 : timerUs.back());
+    summary->setProperty("droppedFrames",         droppedFrames);
+    summary->setProperty("injectedBlocks",        host.injectedBlocks);
+    summary->setProperty("nonFiniteOutputs",      host.nonFiniteOutputs);
+    summary->setProperty("nonFiniteMeterValues",  meterCheck.nonFiniteValues);
+    summary->setProperty("correlationOutOfRange", meterCheck.correlationOutOfRange);
+    summary->setProperty("framesOutOfOrder",      meterCheck.framesOutOfOrder);
+    results.add(juce::var(summary));
+    
+    auto written = Benchmark::writeReport("stress", results, options);
+    
+    if ( host.nonFiniteOutputs + meterCheck.nonFiniteValues + meterCheck.correlationOutOfRange + meterCheck.framesOutOfOrder > 0 )
+        juce::ConsoleApplication::fail("invalid values reached the output or the meters");
+    
+    if ( !written )
+        juce::ConsoleApplication::fail("couldn't write the report");
+}
@@ -0,0 +1,32 @@
+/*
+  ==============================================================================
+
+    StressBenchmark.h
+    Created: 18 Oct 2026 9:58:42pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/*
+Drives the processor the way an unfriendly host would.
+A host thread calls prepareToPlay with sample rates from 44.1k to 384k and
+changing block sizes, then delivers blocks of any size (empty, single
+sample, odd, or several times what was announced) of the scripted signal or
+a random test signal, with the odd NaN or inf mixed in. Meanwhile the message thread runs the editor timer at 8x the
+normal rate, and the whole simulation runs at 8x realtime.
+Reports the worst processBlock time per sample rate, frames dropped
+between audio and editor, and any non-finite output or meter value.
+Exits with an error if anything non-finite got through.
+Build the ThreadSanitizer configuration to have races reported too.
+--seconds is the simulated length of the run.
+*/
+namespace StressBenchmark
+{
+    void run(const juce::ArgumentList& args);
+}
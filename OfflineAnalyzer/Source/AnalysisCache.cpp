@@ -0,0 +1,428 @@
+/*
+  ==============================================================================
+
+    AnalysisCache.cpp
+    Created: 19 Oct 2026 1:07:22am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "AnalysisCache.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+
+static_assert(std::is_trivially_copyable<FileAnalysis::Summary>::value, "summaries are stored as they are");
+
+const std::array<char, 8> magic { 'P', 'F', 'M', 'C', 'A', 'C', 'H', 'E' };
+
+// goes up whenever the layout of the cache file changes
+constexpr juce::uint32 formatVersion = 1;
+
+// audio is hashed through a window of the file mapped at a time, so many
+// threads hashing big files don't run out of address space
+constexpr juce::int64 hashWindowBytes = 64 * 1024 * 1024;
+
+//==============================================================================
+/*
+xxHash64, which runs at memory speed. Fed in pieces, it gives the same hash
+as the whole data at once.
+*/
+class Hash
+{
+public:
+    explicit Hash(const juce::uint64& seed = 0)
+        : seed(seed),
+          lanes { seed + prime1 + prime2, seed + prime2, seed, seed - prime1 }
+    {
+    }
+    
+    void add(const void* data, size_t numBytes)
+    {
+        auto* bytes = static_cast<const juce::uint8*>(data);
+        length += numBytes;
+        
+        if ( numBuffered > 0 )
+        {
+            auto count = std::min(numBytes, stripeBytes - numBuffered);
+            std::memcpy(buffer.data() + numBuffered, bytes, count);
+            numBuffered += count;
+            bytes += count;
+            numBytes -= count;
+            
+            if ( numBuffered < stripeBytes )
+                return;
+            
+            addStripe(buffer.data());
+            numBuffered = 0;
+        }
+        
+        for ( ; numBytes >= stripeBytes; bytes += stripeBytes, numBytes -= stripeBytes )
+            addStripe(bytes);
+        
+        std::memcpy(buffer.data(), bytes, numBytes);
+        numBuffered = numBytes;
+    }
+    
+    template <typename Value>
+    void addValue(const Value& value)
+    {
+        static_assert(std::is_trivially_copyable<Value>::value, "hashed as bytes");
+        add(&value, sizeof(value));
+    }
+    
+    juce::uint64 get() const
+    {
+        juce::uint64 h;
+        
+        if ( length >= stripeBytes )
+        {
+            h = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) + rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18);
+            
+            for ( auto lane : lanes )
+                h = (h ^ round(0, lane)) * prime1 + prime4;
+        }
+        else
+        {
+            h = seed + prime5;
+        }
+        
+        h += length;
+        
+        auto* tail = buffer.data();
+        auto numLeft = numBuffered;
+        
+        for ( ; numLeft >= 8; tail += 8, numLeft -= 8 )
+            h = rotateLeft(h ^ round(0, read<juce::uint64>(tail)), 27) * prime1 + prime4;
+        
+        if ( numLeft >= 4 )
+        {
+            h = rotateLeft(h ^ (read<juce::uint32>(tail) * prime1), 23) * prime2 + prime3;
+            tail += 4;
+            numLeft -= 4;
+        }
+        
+        for ( ; numLeft > 0; ++tail, --numLeft )
+            h = rotateLeft(h ^ (*tail * prime5), 11) * prime1;
+        
+        h ^= h >> 33;
+        h *= prime2;
+        h ^= h >> 29;
+        h *= prime3;
+        h ^= h >> 32;
+        
+        return h;
+    }
+
+private:
+    static constexpr juce::uint64 prime1 = 11400714785074694791ULL;
+    static constexpr juce::uint64 prime2 = 14029467366897019727ULL;
+    static constexpr juce::uint64 prime3 = 1609587929392839161ULL;
+    static constexpr juce::uint64 prime4 = 9650029242287828579ULL;
+    static constexpr juce::uint64 prime5 = 2870177450012600261ULL;
+    static constexpr size_t stripeBytes = 32;
+    
+    static juce::uint64 rotateLeft(const juce::uint64& x, const int& bits)
+    {
+        return (x << bits) | (x >> (64 - bits));
+    }
+    
+    static juce::uint64 round(const juce::uint64& lane, const juce::uint64& input)
+    {
+        return rotateLeft(lane + input * prime2, 31) * prime1;
+    }
+    
+    // little endian whatever the machine, so cache files can be shared
+    template <typename Value>
+    static Value read(const juce::uint8* bytes)
+    {
+        Value value = 0;
+        
+        for ( size_t i = 0; i < sizeof(Value); ++i )
+            value |= static_cast<Value>(bytes[i]) << (8 * i);
+        
+        return value;
+    }
+    
+    void addStripe(const juce::uint8* stripe)
+    {
+        for ( size_t lane = 0; lane < 4; ++lane )
+            lanes[lane] = round(lanes[lane], read<juce::uint64>(stripe + lane * 8));
+    }
+    
+    juce::uint64 seed;
+    std::array<juce::uint64, 4> lanes;
+    std::array<juce::uint8, stripeBytes> buffer {};
+    size_t numBuffered = 0;
+    juce::uint64 length = 0;
+};
+
+//==============================================================================
+// where the samples are in the file, or the whole file for formats that can't be mapped (FLAC, Ogg)
+juce::Range<juce::int64> getAudioData(const FileAnalysis& probed)
+{
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+    
+    if ( auto* format = formats.findFormatForFileExtension(probed.file.getFileExtension()) )
+    {
+        std::unique_ptr<juce::MemoryMappedAudioFormatReader> reader(format->createMemoryMappedReader(probed.file));
+        
+        if ( reader != nullptr && reader->lengthInSamples == probed.lengthInSamples )
+            return { reader->sampleToFilePos(0), reader->sampleToFilePos(probed.lengthInSamples) };
+    }
+    
+    return { 0, probed.file.getSize() };
+}
+
+// 0 if the file couldn't be read, which nothing is ever stored under
+juce::uint64 hashAudioData(const FileAnalysis& probed)
+{
+    auto data = getAudioData(probed);
+    Hash hash;
+    
+    for ( auto start = data.getStart(); start < data.getEnd(); start += hashWindowBytes )
+    {
+        juce::Range<juce::int64> window { start, juce::jmin(start + hashWindowBytes, data.getEnd()) };
+        juce::MemoryMappedFile mapped(probed.file, window, juce::MemoryMappedFile::readOnly);
+        
+        // the mapping starts on a page boundary, so usually a little before the window
+        if ( mapped.getData() == nullptr || !mapped.getRange().contains(window) )
+            return 0;
+        
+        auto* bytes = static_cast<const char*>(mapped.getData()) + (window.getStart() - mapped.getRange().getStart());
+        hash.add(bytes, static_cast<size_t>(window.getLength()));
+    }
+    
+    return hash.get();
+}
+
+// everything besides the audio that changes the results
+void addAnalysisSettings(Hash& hash, const FileAnalysis& probed, const FileAnalysis::Settings& settings)
+{
+    hash.addValue(FileAnalysis::version);
+    hash.addValue(settings.blockSize);
+    hash.addValue(probed.sampleRate);
+    hash.addValue(probed.numChannels);
+    hash.addValue(probed.lengthInSamples);
+}
+
+juce::uint64 getPathHash(const juce::File& file)
+{
+    auto path = file.getFullPathName().toStdString();
+    
+    Hash hash;
+    hash.add(path.data(), path.size());
+    
+    return hash.get();
+}
+
+template <typename Record, typename Key>
+const Record* binarySearch(const Record* records, const size_t& numRecords, const Key& key, juce::uint64 Record::* member)
+{
+    auto* end = records + numRecords;
+    auto* found = std::lower_bound(records, end, key, [member](const Record& record, const Key& k) { return record.*member < k; });
+    
+    return found != end && (*found).*member == key ? found : nullptr;
+}
+
+// sorted by member, with the last of any duplicates kept
+template <typename Record>
+void sortUnique(std::vector<Record>& records, juce::uint64 Record::* member)
+{
+    std::stable_sort(records.begin(), records.end(), [member](const Record& a, const Record& b) { return a.*member < b.*member; });
+    
+    std::vector<Record> unique;
+    
+    for ( auto& record : records )
+    {
+        if ( !unique.empty() && unique.back().*member == record.*member )
+            unique.back() = record;
+        else
+            unique.push_back(record);
+    }
+    
+    records.swap(unique);
+}
+
+}
+
+//==============================================================================
+AnalysisCache::AnalysisCache(const juce::File& file)
+    : cacheFile(file)
+{
+    map();
+}
+
+void AnalysisCache::map()
+{
+    results = nullptr;
+    paths = nullptr;
+    numResults = 0;
+    numPaths = 0;
+    mapped.reset();
+    
+    if ( !cacheFile.existsAsFile() )
+        return;
+    
+    mapped = std::make_unique<juce::MemoryMappedFile>(cacheFile, juce::MemoryMappedFile::readOnly);
+    
+    auto size = mapped->getSize();
+    auto* data = static_cast<const char*>(mapped->getData());
+    
+    if ( data == nullptr || size < sizeof(Header) )
+        return;
+    
+    Header header;
+    std::memcpy(&header, data, sizeof(header));
+    
+    auto expectedSize = sizeof(Header) + header.numResults * sizeof(Result) + header.numPaths * sizeof(Path);
+    
+    // anything written by another layout, or cut short, is treated as empty and replaced by save()
+    if ( header.magic != magic || header.formatVersion != formatVersion || header.resultSize != sizeof(Result) || size != expectedSize )
+        return;
+    
+    // the mapping is page aligned and every record is a multiple of 8 bytes, so the tables can be used in place
+    results = reinterpret_cast<const Result*>(data + sizeof(Header));
+    numResults = static_cast<size_t>(header.numResults);
+    paths = reinterpret_cast<const Path*>(data + sizeof(Header) + numResults * sizeof(Result));
+    numPaths = static_cast<size_t>(header.numPaths);
+}
+
+const AnalysisCache::Result* AnalysisCache::findResult(const juce::uint64& key) const
+{
+    return binarySearch(results, numResults, key, &Result::key);
+}
+
+const AnalysisCache::Path* AnalysisCache::findPath(const juce::uint64& statKey) const
+{
+    return binarySearch(paths, numPaths, statKey, &Path::statKey);
+}
+
+//==============================================================================
+bool AnalysisCache::find(FileAnalysis& probed, const FileAnalysis::Settings& settings) const
+{
+    if ( probed.failed() )
+        return false;
+    
+    Hash stat(getPathHash(probed.file));
+    stat.addValue(probed.file.getSize());
+    stat.addValue(probed.file.getLastModificationTime().toMilliseconds());
+    addAnalysisSettings(stat, probed, settings);
+    probed.statKey = stat.get();
+    
+    const Result* result = nullptr;
+    
+    if ( auto* path = findPath(probed.statKey) )
+    {
+        probed.cacheKey = path->key;
+        result = findResult(path->key);
+    }
+    
+    if ( result == nullptr )
+    {
+        auto contentHash = hashAudioData(probed);
+        
+        if ( contentHash == 0 )
+            return false;
+        
+        Hash key(contentHash);
+        addAnalysisSettings(key, probed, settings);
+        probed.cacheKey = key.get();
+        result = findResult(probed.cacheKey);
+    }
+    
+    if ( result == nullptr )
+        return false;
+    
+    probed.summary = result->summary;
+    probed.fromCache = true;
+    
+    return true;
+}
+
+void AnalysisCache::add(const FileAnalysis& analysis)
+{
+    if ( analysis.failed() || analysis.cacheKey == 0 )
+        return;
+    
+    const juce::ScopedLock sl(lock);
+    
+    if ( !analysis.fromCache )
+        newResults.push_back({ analysis.cacheKey, analysis.summary });
+    
+    newPaths.push_back({ analysis.statKey, getPathHash(analysis.file), analysis.cacheKey });
+}
+
+bool AnalysisCache::save()
+{
+    const juce::ScopedLock sl(lock);
+    
+    std::vector<Result> allResults(results, results + numResults);
+    allResults.insert(allResults.end(), newResults.begin(), newResults.end());
+    sortUnique(allResults, &Result::key);
+    
+    // a path that was just seen replaces what was known about it before, so
+    // files edited many times don't leave a trail of stale entries
+    std::vector<juce::uint64> seenPaths;
+    
+    for ( auto& path : newPaths )
+        seenPaths.push_back(path.pathHash);
+    
+    std::sort(seenPaths.begin(), seenPaths.end());
+    
+    std::vector<Path> allPaths;
+    
+    for ( size_t i = 0; i < numPaths; ++i )
+    {
+        if ( !std::binary_search(seenPaths.begin(), seenPaths.end(), paths[i].pathHash) )
+            allPaths.push_back(paths[i]);
+    }
+    
+    allPaths.insert(allPaths.end(), newPaths.begin(), newPaths.end());
+    sortUnique(allPaths, &Path::statKey);
+    
+    Header header { magic, formatVersion, static_cast<juce::uint32>(sizeof(Result)), allResults.size(), allPaths.size() };
+    
+    // FileOutputStream appends, so start from nothing
+    auto temp = cacheFile.getSiblingFile(cacheFile.getFileName() + ".tmp");
+    temp.deleteFile();
+    
+    {
+        juce::FileOutputStream out(temp);
+        
+        if ( !out.openedOk() )
+            return false;
+        
+        auto written = out.write(&header, sizeof(header))
+                       && out.write(allResults.data(), allResults.size() * sizeof(Result))
+                       && out.write(allPaths.data(), allPaths.size() * sizeof(Path));
+        
+        out.flush();
+        
+        if ( !written || out.getStatus().failed() )
+        {
+            temp.deleteFile();
+            return false;
+        }
+    }
+    
+    // the old file can't be replaced while it's mapped on every platform
+    mapped.reset();
+    
+    auto replaced = temp.moveFileTo(cacheFile);
+    
+    if ( replaced )
+    {
+        newResults.clear();
+        newPaths.clear();
+    }
+    
+    map();
+    
+    return replaced;
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    AnalysisCache.h
+    Created: 19 Oct 2026 1:07:22am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "FileAnalysis.h"
+
+//==============================================================================
+/*
+Offline analysis results kept on disk between runs, so a folder where only a
+few files changed only has those few analysed again.
+Results are keyed by a hash of the file's audio data, mixed with the
+analyzer version and the settings that change the numbers, so a renamed or
+copied file is still found and any change to a sample, or to the analysis,
+misses. Hashing has to read the whole file though, so a second table
+remembers the key each path had at a given size and modification time, and
+a file that hasn't been touched is answered without reading any audio.
+The cache file is a header and two tables of fixed size records sorted by
+key, used in place through a memory map and binary searched, so opening a
+cache of any size costs one mmap.
+*/
+class AnalysisCache
+{
+public:
+    explicit AnalysisCache(const juce::File& cacheFile);
+    
+    // fills in probed.summary and sets fromCache when the file is known, and
+    // its keys either way so add() can store it. Safe from any thread.
+    bool find(FileAnalysis& probed, const FileAnalysis::Settings& settings) const;
+    
+    // remembers a finished analysis, or where a cached one was found, for save(). Safe from any thread.
+    void add(const FileAnalysis& analysis);
+    
+    // writes the old and new entries to a temporary file that then replaces the cache
+    bool save();
+    
+    size_t getNumResults() const { return numResults; }
+
+private:
+    struct Header
+    {
+        std::array<char, 8> magic;
+        juce::uint32 formatVersion;
+        juce::uint32 resultSize;
+        juce::uint64 numResults;
+        juce::uint64 numPaths;
+    };
+    
+    struct Result
+    {
+        juce::uint64 key;
+        FileAnalysis::Summary summary;
+    };
+    
+    struct Path
+    {
+        juce::uint64 statKey;
+        juce::uint64 pathHash;
+        juce::uint64 key;
+    };
+    
+    void map();
+    
+    const Result* findResult(const juce::uint64& key) const;
+    const Path* findPath(const juce::uint64& statKey) const;
+    
+    juce::File cacheFile;
+    
+    std::unique_ptr<juce::MemoryMappedFile> mapped;
+    const Result* results = nullptr;
+    size_t numResults = 0;
+    const Path* paths = nullptr;
+    size_t numPaths = 0;
+    
+    juce::CriticalSection lock;
+    std::vector<Result> newResults;
+    std::vector<Path> newPaths;
+};
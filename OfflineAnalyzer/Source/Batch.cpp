@@ -0,0 +1,169 @@
+/*
+  ==============================================================================
+
+    Batch.cpp
+    Created: 19 Oct 2026 12:21:48am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "Batch.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+namespace
+{
+
+// progress goes to stderr so stdout stays valid JSON
+void log(const juce::String& message)
+{
+    std::cerr << message << std::endl;
+}
+
+// runs job(0) to job(numJobs - 1) on the pool, in that order of starting, and waits for them all
+void runAll(juce::ThreadPool& pool, const size_t& numJobs, const std::function<void(size_t)>& job)
+{
+    for ( size_t i = 0; i < numJobs; ++i )
+        pool.addJob([&job, i] { job(i); });
+    
+    while ( pool.getNumJobs() > 0 )
+        juce::Thread::sleep(10);
+}
+
+struct Segment
+{
+    size_t file;
+    size_t index;
+    juce::Range<juce::int64> section;
+};
+
+}
+
+//==============================================================================
+namespace Batch
+{
+
+juce::Array<juce::File> findAudioFiles(const juce::Array<juce::File>& inputs)
+{
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+    
+    juce::Array<juce::File> files;
+    
+    for ( auto& input : inputs )
+    {
+        if ( !input.isDirectory() )
+        {
+            files.add(input);
+            continue;
+        }
+        
+        auto found = input.findChildFiles(juce::File::findFiles, true, formats.getWildcardForAllFormats());
+        found.sort();
+        files.addArray(found);
+    }
+    
+    return files;
+}
+
+std::vector<FileAnalysis> analyze(const juce::Array<juce::File>& files,
+                                  const FileAnalysis::Settings& settings,
+                                  const int& numThreads,
+                                  AnalysisCache* cache)
+{
+    auto numFiles = static_cast<size_t>(files.size());
+    std::vector<FileAnalysis> results(numFiles);
+    
+    juce::ThreadPool pool(juce::jmax(1, numThreads));
+    
+    // headers first, to know how long everything is and whether it needs analysing at all
+    runAll(pool, numFiles, [&](size_t i)
+    {
+        results[i] = FileAnalysis::probe(files[static_cast<int>(i)], settings);
+        
+        if ( cache != nullptr )
+            cache->find(results[i], settings);
+    });
+    
+    std::vector<Segment> segments;
+    std::vector<std::vector<FileAnalysis>> partials(numFiles);
+    auto numCached = 0;
+    
+    for ( size_t i = 0; i < numFiles; ++i )
+    {
+        if ( results[i].fromCache )
+            ++numCached;
+        
+        if ( results[i].failed() || results[i].fromCache )
+            continue;
+        
+        auto sections = results[i].getSegments(settings);
+        partials[i].resize(sections.size());
+        
+        for ( size_t k = 0; k < sections.size(); ++k )
+            segments.push_back({ i, k, sections[k] });
+    }
+    
+    if ( cache != nullptr )
+        log(juce::String(numCached) + "/" + juce::String(files.size()) + " from the cache");
+    
+    // longest first, so the last jobs to start are the shortest
+    std::stable_sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b)
+    {
+        return a.section.getLength() > b.section.getLength();
+    });
+    
+    std::unique_ptr<std::atomic<size_t>[]> segmentsLeft(new std::atomic<size_t>[numFiles]);
+    std::atomic<int> numFinished { 0 };
+    
+    for ( size_t i = 0; i < numFiles; ++i )
+        segmentsLeft[i] = partials[i].size();
+    
+    runAll(pool, segments.size(), [&](size_t s)
+    {
+        auto& segment = segments[s];
+        auto& file = files.getReference(static_cast<int>(segment.file));
+        
+        // each job writes only its own slot
+        partials[segment.file][segment.index] = FileAnalysis::analyze(results[segment.file], segment.section, settings);
+        
+        if ( --segmentsLeft[segment.file] != 0 )
+            return;
+        
+        // the last segment of a file merges them all, so only the segments of
+        // files still being analysed are held at once. Always in segment order,
+        // so the sums come out the same every run
+        auto& parts = partials[segment.file];
+        auto& result = results[segment.file];
+        result = std::move(parts.front());
+        
+        for ( size_t k = 1; k < parts.size(); ++k )
+            result.merge(parts[k]);
+        
+        std::vector<FileAnalysis>().swap(parts);
+        
+        if ( !result.failed() )
+            result.summarise();
+        
+        log(juce::String(++numFinished) + "/" + juce::String(files.size()) + " " + file.getFileName());
+    });
+    
+    // in file order, so the cache comes out the same every run
+    for ( size_t i = 0; i < numFiles; ++i )
+    {
+        if ( results[i].failed() )
+        {
+            log(files[static_cast<int>(i)].getFileName() + ": " + results[i].error);
+            continue;
+        }
+        
+        if ( cache != nullptr )
+            cache->add(results[i]);
+    }
+    
+    return results;
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    Batch.h
+    Created: 19 Oct 2026 12:21:48am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "AnalysisCache.h"
+#include "FileAnalysis.h"
+
+//==============================================================================
+/*
+Analyses many files at once on a pool of threads.
+Every file is cut into segments (see FileAnalysis), and all the segments of
+all the files go into one queue, longest first, which idle threads take the
+next job from. A few long files keep every core as busy as a folder of short
+ones, and nothing is left running alone at the end. A file's segments are
+merged back in order as soon as its last one is done, so results don't depend
+on which thread got which segment or when, and what's kept of each file once
+it's summarised is little more than its summary.
+*/
+namespace Batch
+{
+
+// the files as given, and every audio file under the directories, each directory in path order
+juce::Array<juce::File> findAudioFiles(const juce::Array<juce::File>& inputs);
+
+// one result per file, in the order given. Files the cache has are answered
+// from it, and everything analysed is added to it, for the caller to save()
+std::vector<FileAnalysis> analyze(const juce::Array<juce::File>& files,
+                                  const FileAnalysis::Settings& settings,
+                                  const int& numThreads,
+                                  AnalysisCache* cache = nullptr);
+
+}
@@ -0,0 +1,533 @@
+/*
+  ==============================================================================
+
+    FileAnalysis.cpp
+    Created: 18 Oct 2026 11:31:12pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "FileAnalysis.h"
+#include "../../Source/AnalysisHistory.h"
+#include "../../Source/FrameAnalyzer.h"
+#include "../../Source/MeterAnalyzer.h"
+#include "../../Source/MeterBallistics.h"
+#include <numeric>
+
+namespace
+{
+
+int getFrameLength(const double& sampleRate)
+{
+    return juce::jmax(1, juce::roundToInt(sampleRate / MeterBallistics::frameRateHz));
+}
+
+juce::int64 roundUp(const juce::int64& samples, const juce::int64& unit)
+{
+    return ((samples + unit - 1) / unit) * unit;
+}
+
+// the same channels, numSamples further on
+std::array<float*, Globals::maxChannels> offset(float* const* channels, const int& numChannels, const int& numSamples)
+{
+    std::array<float*, Globals::maxChannels> offsetChannels {};
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+        offsetChannels[ch] = channels[ch] + numSamples;
+    
+    return offsetChannels;
+}
+
+//==============================================================================
+/*
+The analysis objects for one file or segment, too big for a pool thread's stack.
+Frames are measured from frameStart and loudness from loudnessStart, each on
+a boundary of its own and far enough ahead of the section to fill its
+windows; only what comes after the start of the section counts.
+*/
+struct Analysis
+{
+    Analysis(FileAnalysis& r, const FileAnalysis::Settings& settings, const juce::Range<juce::int64>& section) : result(r)
+    {
+        blockSize = juce::jmax(1, settings.blockSize);
+        frameLength = getFrameLength(result.sampleRate);
+        measureFrom = section.getStart();
+        
+        // the longest correlation window is six blocks
+        frameStart = juce::jmax(static_cast<juce::int64>(0), measureFrom - roundUp(6 * blockSize + frameLength, frameLength));
+        
+        // the short-term window, and half a second more for the filters to settle
+        auto stepLength = static_cast<juce::int64>(LoudnessAnalyzer::getStepLength(result.sampleRate));
+        loudnessStart = juce::jmax(static_cast<juce::int64>(0), measureFrom - (LoudnessAnalyzer::shortTermSteps + 5) * stepLength);
+        
+        frameAnalyzer.prepare(result.sampleRate, blockSize);
+        meters.setNumChannels(result.numChannels);
+        loudness.prepare(result.sampleRate, result.channelLayout);
+        
+        result.rmsHistogram.assign(static_cast<size_t>(FileAnalysis::numHistogramBins), 0);
+        result.peakHistogram.assign(static_cast<size_t>(FileAnalysis::numHistogramBins), 0);
+    }
+    
+    juce::int64 getReadStart() const { return juce::jmin(frameStart, loudnessStart); }
+    
+    // the most samples that can go in between drains without the history lapping us
+    juce::int64 getMaxChunkSize() const
+    {
+        return static_cast<juce::int64>(AnalysisHistory::capacity / 2) * frameLength;
+    }
+    
+    void process(float* const* channels, const juce::int64& position, const int& numSamples)
+    {
+        // measuring starts exactly at the start of the section
+        if ( position < measureFrom && position + numSamples > measureFrom )
+        {
+            auto before = static_cast<int>(measureFrom - position);
+            process(channels, position, before);
+            process(offset(channels, result.numChannels, before).data(), measureFrom, numSamples - before);
+            return;
+        }
+        
+        if ( position == measureFrom )
+            loudness.clearMeasurements();
+        
+        auto frameOffset = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0), static_cast<juce::int64>(numSamples), frameStart - position));
+        
+        for ( auto start = frameOffset; start < numSamples; start += blockSize )
+        {
+            auto count = juce::jmin(blockSize, numSamples - start);
+            
+            block.setDataToReferTo(channels, result.numChannels, start, count);
+            frameAnalyzer.process(block, noReference, history, result.numChannels > 1);
+        }
+        
+        samplesProcessed += numSamples - frameOffset;
+        
+        auto loudnessOffset = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0), static_cast<juce::int64>(numSamples), loudnessStart - position));
+        
+        if ( loudnessOffset < numSamples )
+            loudness.process(offset(channels, result.numChannels, loudnessOffset).data(), result.numChannels, numSamples - loudnessOffset);
+        
+        drain();
+    }
+    
+    // only the end of the file can leave a partial frame
+    void finish(juce::AudioBuffer<float>& scratch)
+    {
+        auto remainder = static_cast<int>(samplesProcessed % frameLength);
+        
+        if ( remainder > 0 )
+        {
+            scratch.clear();
+            auto padding = frameLength - remainder;
+            
+            for ( auto start = 0; start < padding; start += blockSize )
+            {
+                auto count = juce::jmin(blockSize, padding - start);
+                
+                block.setDataToReferTo(scratch.getArrayOfWritePointers(), result.numChannels, 0, count);
+                frameAnalyzer.process(block, noReference, history, result.numChannels > 1);
+            }
+            
+            drain();
+        }
+        
+        result.gatingBlocks = std::make_unique<FileAnalysis::GatingBlocks>();
+        result.gatingBlocks->momentary = loudness.getIntegratedBlocks();
+        result.gatingBlocks->shortTerm = loudness.getRangeBlocks();
+        result.maxMomentaryLufs = loudness.getMaxMomentaryLufs();
+        result.maxShortTermLufs = loudness.getMaxShortTermLufs();
+    }
+
+private:
+    // what AnalysisState::consume() does with each frame, plus the totals
+    void drain()
+    {
+        for ( ; nextFrame < history.getNumWritten(); ++nextFrame )
+        {
+            // pre-roll
+            if ( frameStart + static_cast<juce::int64>(nextFrame) * frameLength < measureFrom )
+                continue;
+            
+            history.read(nextFrame, frame);
+            
+            auto nowMs = static_cast<juce::int64>(result.numFrames * 1000 / MeterBallistics::frameRateHz);
+            meters.process(frame, nowMs);
+            meters.advance(nowMs);
+            
+            addToHistogram(result.rmsHistogram, meters.getMeanRmsDb(Main));
+            addToHistogram(result.peakHistogram, meters.getMeanPeakDb(Main));
+            
+            for ( auto ch = 0; ch < result.numChannels; ++ch )
+            {
+                result.peakDb[ch] = juce::jmax(result.peakDb[ch], frame.peakDb[ch]);
+                
+                // frames at the floor count as silence, as they do on the meters
+                if ( frame.rmsDb[ch] > Globals::negInf() )
+                    result.sumOfFrameEnergy[ch] += juce::Decibels::decibelsToGain(static_cast<double>(frame.rmsDb[ch]) * 2.0);
+            }
+            
+            if ( result.numChannels > 1 )
+            {
+                result.sumOfCorrelation += frame.averageCorrelation[Main];
+                result.minCorrelation = juce::jmin(result.minCorrelation, frame.averageCorrelation[Main]);
+            }
+            
+            ++result.numFrames;
+        }
+    }
+    
+    static void addToHistogram(std::vector<juce::uint64>& histogram, const float& db)
+    {
+        auto bin = static_cast<int>(std::floor(db - Globals::negInf()));
+        ++histogram[static_cast<size_t>(juce::jlimit(0, static_cast<int>(histogram.size()) - 1, bin))];
+    }
+    
+    FileAnalysis& result;
+    
+    int blockSize = 512;
+    int frameLength = 1200;
+    
+    juce::int64 measureFrom = 0;
+    juce::int64 frameStart = 0;
+    juce::int64 loudnessStart = 0;
+    juce::int64 samplesProcessed = 0;
+    
+    FrameAnalyzer frameAnalyzer;
+    AnalysisHistory history;
+    MeterAnalyzer meters;
+    LoudnessAnalyzer loudness;
+    
+    juce::AudioBuffer<float> block;
+    juce::AudioBuffer<float> noReference;
+    
+    juce::uint64 nextFrame = 0;
+    AnalysisFrame frame;
+};
+
+//==============================================================================
+/*
+Reads a file a chunk at a time. WAV and AIFF are read through a memory map
+of just the chunk being read, which moves along the file with the chunks:
+samples are converted from the mapped pages straight into the chunk, with no
+read calls or buffering in between, and the pages of earlier chunks are
+unmapped as it goes so resident memory stays the same for any length of
+file. Other formats go through the format's usual reader.
+*/
+struct ChunkReader
+{
+    bool open(const juce::File& file, const bool& useMemoryMap)
+    {
+        formats.registerBasicFormats();
+        
+        if ( useMemoryMap )
+        {
+            if ( auto* format = formats.findFormatForFileExtension(file.getFileExtension()) )
+                mapped.reset(format->createMemoryMappedReader(file));
+        }
+        
+        if ( mapped == nullptr )
+            buffered.reset(formats.createReaderFor(file));
+        
+        reader = mapped != nullptr ? static_cast<juce::AudioFormatReader*>(mapped.get()) : buffered.get();
+        
+        return reader != nullptr;
+    }
+    
+    juce::AudioFormatReader* operator->() const { return reader; }
+    
+    bool isMemoryMapped() const { return mapped != nullptr; }
+    
+    // a memory mapped reader doesn't keep the WAV channel mask, so ask the
+    // format's usual reader; files with no layout of their own get the
+    // format's default for their channel count
+    juce::AudioChannelSet getChannelLayout(const juce::File& file)
+    {
+        std::unique_ptr<juce::AudioFormatReader> described;
+        
+        if ( mapped != nullptr )
+            described.reset(formats.createReaderFor(file));
+        
+        auto layout = (described != nullptr ? described.get() : reader)->getChannelLayout();
+        
+        if ( layout.size() != static_cast<int>(reader->numChannels) )
+            return juce::AudioChannelSet::discreteChannels(static_cast<int>(reader->numChannels));
+        
+        return layout;
+    }
+    
+    // so every chunk after the first starts at the same offset into a page,
+    // and no mapping covers more pages than its samples need
+    int roundToWholePages(const int& chunkSize) const
+    {
+        if ( mapped == nullptr )
+            return chunkSize;
+        
+        auto bytesPerFrame = static_cast<int>(mapped->sampleToFilePos(1) - mapped->sampleToFilePos(0));
+        
+        if ( bytesPerFrame <= 0 )
+            return chunkSize;
+        
+        auto framesPerUnit = pageSize / std::gcd(pageSize, bytesPerFrame);
+        
+        return juce::jmax(framesPerUnit, chunkSize - (chunkSize % framesPerUnit));
+    }
+    
+    bool read(float* const* destination, const int& numChannels, const juce::int64& start, const int& numSamples)
+    {
+        // remapping releases the previous chunk's pages
+        if ( mapped != nullptr && !mapped->mapSectionOfFile({ start, start + numSamples }) )
+            return false;
+        
+        return reader->read(destination, numChannels, start, numSamples);
+    }
+
+private:
+    // the smallest page size of the platforms this builds for
+    static constexpr int pageSize = 4096;
+    
+    juce::AudioFormatManager formats;
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped;
+    std::unique_ptr<juce::AudioFormatReader> buffered;
+    juce::AudioFormatReader* reader = nullptr;
+};
+
+}
+
+//==============================================================================
+FileAnalysis FileAnalysis::probe(const juce::File& file, const Settings& settings)
+{
+    FileAnalysis result;
+    result.file = file;
+    result.peakDb.fill(Globals::negInf());
+    
+    ChunkReader reader;
+    
+    if ( !reader.open(file, settings.useMemoryMap) )
+    {
+        result.error = file.existsAsFile() ? "not a format that can be read" : "file not found";
+        return result;
+    }
+    
+    result.format = reader->getFormatName();
+    result.memoryMapped = reader.isMemoryMapped();
+    result.sampleRate = reader->sampleRate;
+    result.numChannels = static_cast<int>(reader->numChannels);
+    result.lengthInSamples = reader->lengthInSamples;
+    result.channelLayout = reader.getChannelLayout(file);
+    
+    if ( result.numChannels < 1 || result.numChannels > Globals::maxChannels || result.sampleRate <= 0.0 )
+        result.error = "unsupported layout: " + juce::String(result.numChannels) + " channels at " + juce::String(result.sampleRate) + "Hz";
+    
+    return result;
+}
+
+FileAnalysis FileAnalysis::analyze(const FileAnalysis& probed, const juce::Range<juce::int64>& section, const Settings& settings)
+{
+    // everything probe() and the cache found; a probed file has no measurements to copy
+    FileAnalysis result;
+    result.file = probed.file;
+    result.error = probed.error;
+    result.format = probed.format;
+    result.memoryMapped = probed.memoryMapped;
+    result.sampleRate = probed.sampleRate;
+    result.numChannels = probed.numChannels;
+    result.lengthInSamples = probed.lengthInSamples;
+    result.channelLayout = probed.channelLayout;
+    result.cacheKey = probed.cacheKey;
+    result.statKey = probed.statKey;
+    result.peakDb = probed.peakDb;
+    
+    if ( result.failed() )
+        return result;
+    
+    ChunkReader reader;
+    
+    if ( !reader.open(result.file, settings.useMemoryMap) )
+    {
+        result.error = "couldn't be opened again";
+        return result;
+    }
+    
+    auto analysis = std::make_unique<Analysis>(result, settings, section);
+    
+    auto chunkSize = static_cast<int>(juce::jlimit(static_cast<juce::int64>(settings.blockSize),
+                                                   analysis->getMaxChunkSize(),
+                                                   static_cast<juce::int64>(settings.chunkSize)));
+    chunkSize = reader.roundToWholePages(chunkSize);
+    
+    // the only copy of the audio: the file's samples converted to float, straight
+    // from the mapping where there is one, and reused for every chunk
+    juce::AudioBuffer<float> chunk(result.numChannels, chunkSize);
+    
+    for ( auto position = analysis->getReadStart(); position < section.getEnd(); position += chunkSize )
+    {
+        auto count = static_cast<int>(juce::jmin(static_cast<juce::int64>(chunkSize), section.getEnd() - position));
+        
+        if ( !reader.read(chunk.getArrayOfWritePointers(), result.numChannels, position, count) )
+        {
+            result.error = "read failed at sample " + juce::String(position);
+            return result;
+        }
+        
+        analysis->process(chunk.getArrayOfWritePointers(), position, count);
+    }
+    
+    analysis->finish(chunk);
+    
+    return result;
+}
+
+FileAnalysis FileAnalysis::analyze(const juce::File& file, const Settings& settings)
+{
+    auto probed = probe(file, settings);
+    auto result = analyze(probed, { 0, probed.lengthInSamples }, settings);
+    
+    if ( !result.failed() )
+        result.summarise();
+    
+    return result;
+}
+
+std::vector<juce::Range<juce::int64>> FileAnalysis::getSegments(const Settings& settings) const
+{
+    // boundaries have to fall between both frames and loudness steps
+    auto unit = static_cast<juce::int64>(std::lcm(getFrameLength(sampleRate), LoudnessAnalyzer::getStepLength(sampleRate)));
+    auto segmentLength = juce::jmax(unit, roundUp(static_cast<juce::int64>(settings.segmentSeconds * sampleRate), unit));
+    
+    std::vector<juce::Range<juce::int64>> segments;
+    juce::int64 start = 0;
+    
+    do
+    {
+        segments.push_back({ start, juce::jmin(start + segmentLength, lengthInSamples) });
+        start += segmentLength;
+    }
+    while ( start < lengthInSamples );
+    
+    return segments;
+}
+
+void FileAnalysis::merge(const FileAnalysis& next)
+{
+    if ( next.failed() )
+    {
+        if ( !failed() )
+            error = next.error;
+        
+        return;
+    }
+    
+    // a failed segment left nothing to merge into
+    if ( failed() )
+        return;
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        peakDb[ch] = juce::jmax(peakDb[ch], next.peakDb[ch]);
+        sumOfFrameEnergy[ch] += next.sumOfFrameEnergy[ch];
+    }
+    
+    numFrames += next.numFrames;
+    sumOfCorrelation += next.sumOfCorrelation;
+    minCorrelation = juce::jmin(minCorrelation, next.minCorrelation);
+    
+    for ( size_t bin = 0; bin < rmsHistogram.size(); ++bin )
+    {
+        rmsHistogram[bin] += next.rmsHistogram[bin];
+        peakHistogram[bin] += next.peakHistogram[bin];
+    }
+    
+    gatingBlocks->momentary.merge(next.gatingBlocks->momentary);
+    gatingBlocks->shortTerm.merge(next.gatingBlocks->shortTerm);
+    maxMomentaryLufs = juce::jmax(maxMomentaryLufs, next.maxMomentaryLufs);
+    maxShortTermLufs = juce::jmax(maxShortTermLufs, next.maxShortTermLufs);
+}
+
+void FileAnalysis::summarise()
+{
+    jassert(Globals::negInf() + numHistogramBins == Globals::maxDb());
+    
+    summary = {};
+    summary.numFrames = numFrames;
+    summary.hasCorrelation = hasCorrelation() ? 1 : 0;
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        summary.peakDb[ch] = getPeakDb(ch);
+        summary.rmsDb[ch] = getRmsDb(ch);
+    }
+    
+    summary.overallPeakDb = getPeakDb();
+    summary.overallRmsDb = getRmsDb();
+    
+    summary.integratedLufs = getIntegratedLufs();
+    summary.loudnessRange = getLoudnessRange();
+    summary.maxMomentaryLufs = maxMomentaryLufs;
+    summary.maxShortTermLufs = maxShortTermLufs;
+    
+    summary.meanCorrelation = getMeanCorrelation();
+    summary.minCorrelation = getMinCorrelation();
+    
+    // a uint32 of frames is over three years of audio at 40 frames a second
+    for ( size_t bin = 0; bin < rmsHistogram.size(); ++bin )
+    {
+        summary.rmsHistogram[bin] = static_cast<juce::uint32>(rmsHistogram[bin]);
+        summary.peakHistogram[bin] = static_cast<juce::uint32>(peakHistogram[bin]);
+    }
+    
+    gatingBlocks.reset();
+    std::vector<juce::uint64>().swap(rmsHistogram);
+    std::vector<juce::uint64>().swap(peakHistogram);
+}
+
+//==============================================================================
+float FileAnalysis::getPeakDb(const int& channel) const
+{
+    return peakDb[channel];
+}
+
+float FileAnalysis::getRmsDb(const int& channel) const
+{
+    if ( numFrames == 0 )
+        return Globals::negInf();
+    
+    auto meanSquare = sumOfFrameEnergy[channel] / static_cast<double>(numFrames);
+    
+    return static_cast<float>(juce::Decibels::gainToDecibels(meanSquare, static_cast<double>(Globals::negInf()) * 2.0) * 0.5);
+}
+
+float FileAnalysis::getPeakDb() const
+{
+    auto db = Globals::negInf();
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+        db = juce::jmax(db, getPeakDb(ch));
+    
+    return db;
+}
+
+float FileAnalysis::getRmsDb() const
+{
+    if ( numFrames == 0 || numChannels == 0 )
+        return Globals::negInf();
+    
+    auto sum = 0.0;
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+        sum += sumOfFrameEnergy[ch];
+    
+    auto meanSquare = sum / (static_cast<double>(numFrames) * numChannels);
+    
+    return static_cast<float>(juce::Decibels::gainToDecibels(meanSquare, static_cast<double>(Globals::negInf()) * 2.0) * 0.5);
+}
+
+float FileAnalysis::getMeanCorrelation() const
+{
+    return hasCorrelation() ? static_cast<float>(sumOfCorrelation / static_cast<double>(numFrames)) : 0.f;
+}
+
+float FileAnalysis::getHistogramBinDb(const int& bin)
+{
+    return Globals::negInf() + static_cast<float>(bin);
+}
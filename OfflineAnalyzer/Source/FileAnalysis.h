@@ -0,0 +1,171 @@
+/*
+  ==============================================================================
+
+    FileAnalysis.h
+    Created: 18 Oct 2026 11:31:12pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <memory>
+#include <vector>
+#include "../../Source/Globals.h"
+#include "../../Source/LoudnessAnalyzer.h"
+
+//==============================================================================
+/*
+One audio file run through the plugin's analysis, as fast as it can be read.
+Audio goes to FrameAnalyzer in host sized blocks, the frames it produces go
+through MeterAnalyzer exactly as AnalysisState does in the plugin, and
+LoudnessAnalyzer measures the same audio alongside. The numbers are built
+from frames, so they are what the plugin's meters and histograms would show
+for the file played from start to end.
+The last partial frame is completed with silence so a peak right at the end
+still counts.
+A long file can be cut into segments that are analysed separately and merged
+back together in order. Each segment is read from a few seconds before its
+start, so the correlation and loudness windows are full when measuring begins,
+and segments start on a frame and loudness step boundary. Merged results are
+approximately, not exactly, those of one pass over the whole file:
+- frames, loudness steps and correlation groups fall where they would in one
+  pass (groups divide both the frame and the block length, so which block a
+  sample came in doesn't change the correlation windows)
+- the K-weighting filters start from silence at each pre-roll and get half a
+  second to settle before the first short-term window they feed, and energy
+  and correlation sums are added up in a different order
+Peaks are exact. Energy sums and gating block energies agree to within 1e-12
+of their value (well under 1e-10 dB or LU), so bin counts and every figure a
+report shows come out the same unless a value lies that close to a bin edge.
+*/
+struct FileAnalysis
+{
+    // goes up whenever a change to the analysis changes its numbers, so cached results are thrown away
+    static constexpr int version = 2;
+    
+    struct Settings
+    {
+        // samples read from the file at a time
+        int chunkSize = 65536;
+        
+        // the correlation averaging follows the host block size, so use the
+        // session's to get the same correlation readings
+        int blockSize = 512;
+        
+        // read WAV and AIFF through a memory map rather than buffered reads
+        bool useMemoryMap = true;
+        
+        // files longer than this are cut into segments of about this length
+        double segmentSeconds = 120.0;
+    };
+    
+    // opens the file and fills in its format and length, or the error
+    static FileAnalysis probe(const juce::File& file, const Settings& settings);
+    
+    // the whole of a file probe() opened, or one segment of it
+    static FileAnalysis analyze(const FileAnalysis& probed, const juce::Range<juce::int64>& section, const Settings& settings);
+    static FileAnalysis analyze(const juce::File& file, const Settings& settings);
+    
+    // segments that start on frame and loudness step boundaries and cover the file
+    std::vector<juce::Range<juce::int64>> getSegments(const Settings& settings) const;
+    
+    // adds the measurements of the segment that follows this one
+    void merge(const FileAnalysis& next);
+    
+    bool failed() const { return error.isNotEmpty(); }
+    
+    // per channel, in decibels, floored at Globals::negInf() like the meters
+    float getPeakDb(const int& channel) const;
+    float getRmsDb(const int& channel) const;
+    
+    // over every channel
+    float getPeakDb() const;
+    float getRmsDb() const;
+    
+    bool hasCorrelation() const { return numChannels > 1 && numFrames > 0; }
+    float getMeanCorrelation() const;
+    float getMinCorrelation() const { return minCorrelation; }
+    
+    // only until summarise(), which lets the gating blocks go
+    float getIntegratedLufs() const { return LoudnessAnalyzer::getIntegratedLufs(gatingBlocks->momentary); }
+    float getLoudnessRange() const { return LoudnessAnalyzer::getLoudnessRange(gatingBlocks->shortTerm); }
+    
+    // 1dB bins from Globals::negInf() to Globals::maxDb() of the values the
+    // plugin's level histograms plot (the mean across channels, per frame)
+    static constexpr int numHistogramBins = 54;
+    static float getHistogramBinDb(const int& bin);
+    
+    /*
+    Everything the reports show, worked out once every segment is merged.
+    Plain fixed size data, so the cache can store it as it is.
+    */
+    struct Summary
+    {
+        juce::uint64 numFrames = 0;
+        juce::int32 hasCorrelation = 0;
+        
+        std::array<float, Globals::maxChannels> peakDb {};
+        std::array<float, Globals::maxChannels> rmsDb {};
+        float overallPeakDb = 0.f;
+        float overallRmsDb = 0.f;
+        
+        float integratedLufs = 0.f;
+        float loudnessRange = 0.f;
+        float maxMomentaryLufs = 0.f;
+        float maxShortTermLufs = 0.f;
+        
+        float meanCorrelation = 0.f;
+        float minCorrelation = 0.f;
+        
+        std::array<juce::uint32, numHistogramBins> rmsHistogram {};
+        std::array<juce::uint32, numHistogramBins> peakHistogram {};
+    };
+    
+    // fills in summary, once the last segment is merged, and frees the
+    // histograms it was worked out from so a finished file is little more
+    // than its summary
+    void summarise();
+    Summary summary;
+    
+    // where summary came from, and what the cache knows this file by (see AnalysisCache)
+    bool fromCache = false;
+    juce::uint64 cacheKey = 0;
+    juce::uint64 statKey = 0;
+    
+    juce::File file;
+    juce::String error;
+    
+    juce::String format;
+    bool memoryMapped = false;
+    double sampleRate = 0.0;
+    int numChannels = 0;
+    juce::int64 lengthInSamples = 0;
+    
+    // from the WAV channel mask where there is one, for the loudness channel weights
+    juce::AudioChannelSet channelLayout;
+    juce::uint64 numFrames = 0;
+    
+    std::array<float, Globals::maxChannels> peakDb;
+    std::array<double, Globals::maxChannels> sumOfFrameEnergy {};
+    
+    double sumOfCorrelation = 0.0;
+    float minCorrelation = 1.f;
+    
+    std::vector<juce::uint64> rmsHistogram;
+    std::vector<juce::uint64> peakHistogram;
+    
+    // 16KB each, so on the heap, and only while there's something to merge
+    struct GatingBlocks
+    {
+        LoudnessAnalyzer::GatingHistogram momentary;
+        LoudnessAnalyzer::GatingHistogram shortTerm;
+    };
+    
+    std::unique_ptr<GatingBlocks> gatingBlocks;
+    float maxMomentaryLufs = LoudnessAnalyzer::minLufs;
+    float maxShortTermLufs = LoudnessAnalyzer::minLufs;
+};
@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 18 Oct 2026 11:52:37pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <iostream>
+#include "AnalysisCache.h"
+#include "Batch.h"
+#include "FileAnalysis.h"
+#include "Report.h"
+
+//==============================================================================
+/*
+Runs audio files through the plugin's analysis code, faster than realtime,
+for checking deliveries without playing them through a DAW.
+Takes files and directories; directories are searched for audio files all
+the way down. Long files are cut into segments and everything is analysed
+in parallel, one thread per core by default (see Batch). The reports list
+the files in the order given, directories in path order, whatever order
+the work finished in.
+Usage: OfflineAnalyzer [--json report.json] [--csv report.csv] [--threads n]
+                       [--segment seconds] [--chunk samples] [--block samples]
+                       [--no-mmap] [--cache file] files or directories...
+Without --json or --csv the JSON report goes to stdout.
+--segment is the length files are cut into, 120 seconds by default.
+--block is the host block size to measure correlation at, 512 by default.
+--no-mmap reads WAV and AIFF with buffered reads instead of a memory map.
+--cache keeps results in the given file, created if it doesn't exist, and
+only analyses the files it doesn't already have (see AnalysisCache).
+The exit code is non-zero if any file couldn't be analysed.
+*/
+namespace
+{
+
+const juce::StringArray valueOptions { "--json", "--csv", "--threads", "--segment", "--chunk", "--block", "--cache" };
+
+// progress goes to stderr so stdout stays valid JSON
+void log(const juce::String& message)
+{
+    std::cerr << message << std::endl;
+}
+
+int getIntOption(const juce::ArgumentList& args, const juce::String& option, const int& defaultValue)
+{
+    auto value = args.getValueForOption(option);
+    return value.isNotEmpty() ? value.getIntValue() : defaultValue;
+}
+
+juce::Array<juce::File> getInputFiles(const juce::ArgumentList& args)
+{
+    juce::Array<juce::File> files;
+    
+    for ( auto i = 0; i < args.size(); ++i )
+    {
+        if ( valueOptions.contains(args[i].text) )
+        {
+            ++i;
+            continue;
+        }
+        
+        if ( args[i].isOption() )
+            continue;
+        
+        files.add(args[i].resolveAsFile());
+    }
+    
+    return files;
+}
+
+bool write(const juce::String& option, const juce::String& text, const juce::ArgumentList& args)
+{
+    auto file = args.getFileForOption(option);
+    
+    if ( file.replaceWithText(text) )
+        return true;
+    
+    log("couldn't write " + file.getFullPathName());
+    return false;
+}
+
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+    auto files = Batch::findAudioFiles(getInputFiles(args));
+    
+    if ( files.isEmpty() )
+    {
+        log("usage: OfflineAnalyzer [--json report.json] [--csv report.csv] [--threads n] [--segment seconds] "
+            "[--chunk samples] [--block samples] [--no-mmap] [--cache file] files or directories...");
+        return 1;
+    }
+    
+    FileAnalysis::Settings settings;
+    settings.chunkSize = juce::jmax(1, getIntOption(args, "--chunk", settings.chunkSize));
+    settings.blockSize = juce::jmax(1, getIntOption(args, "--block", settings.blockSize));
+    settings.useMemoryMap = !args.containsOption("--no-mmap");
+    
+    auto segmentSeconds = args.getValueForOption("--segment");
+    
+    if ( segmentSeconds.isNotEmpty() )
+        settings.segmentSeconds = juce::jmax(1.0, segmentSeconds.getDoubleValue());
+    
+    auto numThreads = juce::jmax(1, getIntOption(args, "--threads", juce::SystemStats::getNumCpus()));
+    
+    std::unique_ptr<AnalysisCache> cache;
+    
+    if ( args.containsOption("--cache") )
+        cache = std::make_unique<AnalysisCache>(args.getFileForOption("--cache"));
+    
+    auto start = juce::Time::getMillisecondCounterHiRes();
+    auto analyses = Batch::analyze(files, settings, numThreads, cache.get());
+    
+    auto seconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+    auto audioSeconds = 0.0;
+    auto numFailed = 0;
+    
+    for ( auto& analysis : analyses )
+    {
+        if ( analysis.failed() )
+            ++numFailed;
+        else
+            audioSeconds += static_cast<double>(analysis.lengthInSamples) / analysis.sampleRate;
+    }
+    
+    log("analysed " + juce::String(audioSeconds, 1) + "s of audio in " + juce::String(seconds, 1) + "s on "
+        + juce::String(numThreads) + " threads (" + juce::String(audioSeconds / juce::jmax(seconds, 0.001), 0) + "x realtime)");
+    
+    auto written = true;
+    
+    if ( cache != nullptr && !cache->save() )
+    {
+        log("couldn't write " + args.getFileForOption("--cache").getFullPathName());
+        written = false;
+    }
+    
+    if ( args.containsOption("--json") )
+        written = write("--json", juce::JSON::toString(Report::toJson(analyses)), args) && written;
+    
+    if ( args.containsOption("--csv") )
+        written = write("--csv", Report::toCsv(analyses), args) && written;
+    
+    if ( !args.containsOption("--json") && !args.containsOption("--csv") )
+        std::cout << juce::JSON::toString(Report::toJson(analyses)) << std::endl;
+    
+    return written && numFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/*
+  ==============================================================================
+
+    Report.cpp
+    Created: 18 Oct 2026 11:44:05pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "Report.h"
+
+namespace
+{
+
+//==============================================================================
+juce::var toVar(const std::array<juce::uint32, FileAnalysis::numHistogramBins>& counts)
+{
+    juce::Array<juce::var> values;
+    
+    for ( auto count : counts )
+        values.add(static_cast<juce::int64>(count));
+    
+    return values;
+}
+
+juce::var toVar(const FileAnalysis& analysis)
+{
+    auto* result = new juce::DynamicObject();
+    result->setProperty("file", analysis.file.getFullPathName());
+    
+    if ( analysis.failed() )
+    {
+        result->setProperty("error", analysis.error);
+        return juce::var(result);
+    }
+    
+    auto& summary = analysis.summary;
+    
+    result->setProperty("format",       analysis.format);
+    result->setProperty("memoryMapped", analysis.memoryMapped);
+    result->setProperty("fromCache",    analysis.fromCache);
+    result->setProperty("sampleRate",   analysis.sampleRate);
+    result->setProperty("numChannels",  analysis.numChannels);
+    result->setProperty("seconds",      static_cast<double>(analysis.lengthInSamples) / analysis.sampleRate);
+    result->setProperty("frames",       static_cast<juce::int64>(summary.numFrames));
+    
+    juce::Array<juce::var> peakDb, rmsDb;
+    
+    for ( auto ch = 0; ch < analysis.numChannels; ++ch )
+    {
+        peakDb.add(summary.peakDb[ch]);
+        rmsDb.add(summary.rmsDb[ch]);
+    }
+    
+    result->setProperty("peakDb", peakDb);
+    result->setProperty("rmsDb",  rmsDb);
+    
+    auto* loudness = new juce::DynamicObject();
+    loudness->setProperty("integratedLufs",   summary.integratedLufs);
+    loudness->setProperty("rangeLu",          summary.loudnessRange);
+    loudness->setProperty("maxMomentaryLufs", summary.maxMomentaryLufs);
+    loudness->setProperty("maxShortTermLufs", summary.maxShortTermLufs);
+    result->setProperty("loudness", juce::var(loudness));
+    
+    if ( summary.hasCorrelation != 0 )
+    {
+        auto* correlation = new juce::DynamicObject();
+        correlation->setProperty("mean", summary.meanCorrelation);
+        correlation->setProperty("min",  summary.minCorrelation);
+        result->setProperty("correlation", juce::var(correlation));
+    }
+    
+    juce::Array<juce::var> binDb;
+    
+    for ( auto bin = 0; bin < FileAnalysis::numHistogramBins; ++bin )
+        binDb.add(FileAnalysis::getHistogramBinDb(bin));
+    
+    auto* histograms = new juce::DynamicObject();
+    histograms->setProperty("binDb", binDb);
+    histograms->setProperty("rms",   toVar(summary.rmsHistogram));
+    histograms->setProperty("peak",  toVar(summary.peakHistogram));
+    result->setProperty("histograms", juce::var(histograms));
+    
+    return juce::var(result);
+}
+
+// quoted when it has to be, with quotes doubled
+juce::String toCsvField(const juce::String& text)
+{
+    if ( !text.containsAnyOf(",\"\r\n") )
+        return text;
+    
+    return "\"" + text.replace("\"", "\"\"") + "\"";
+}
+
+}
+
+//==============================================================================
+namespace Report
+{
+
+juce::var toJson(const std::vector<FileAnalysis>& analyses)
+{
+    juce::Array<juce::var> files;
+    
+    for ( auto& analysis : analyses )
+        files.add(toVar(analysis));
+    
+    auto* report = new juce::DynamicObject();
+    report->setProperty("analyzerVersion", FileAnalysis::version);
+    report->setProperty("files", files);
+    
+    return juce::var(report);
+}
+
+juce::String toCsv(const std::vector<FileAnalysis>& analyses)
+{
+    juce::StringArray lines;
+    lines.add("file,format,sampleRate,numChannels,seconds,peakDb,rmsDb,integratedLufs,rangeLu,"
+              "maxMomentaryLufs,maxShortTermLufs,correlationMean,correlationMin,error");
+    
+    for ( auto& analysis : analyses )
+    {
+        juce::StringArray fields;
+        fields.add(toCsvField(analysis.file.getFullPathName()));
+        
+        if ( analysis.failed() )
+        {
+            for ( auto i = 0; i < 12; ++i )
+                fields.add({});
+            
+            fields.add(toCsvField(analysis.error));
+            lines.add(fields.joinIntoString(","));
+            continue;
+        }
+        
+        auto& summary = analysis.summary;
+        auto hasCorrelation = summary.hasCorrelation != 0;
+        
+        fields.add(toCsvField(analysis.format));
+        fields.add(juce::String(analysis.sampleRate));
+        fields.add(juce::String(analysis.numChannels));
+        fields.add(juce::String(static_cast<double>(analysis.lengthInSamples) / analysis.sampleRate, 3));
+        fields.add(juce::String(summary.overallPeakDb, 2));
+        fields.add(juce::String(summary.overallRmsDb, 2));
+        fields.add(juce::String(summary.integratedLufs, 1));
+        fields.add(juce::String(summary.loudnessRange, 1));
+        fields.add(juce::String(summary.maxMomentaryLufs, 1));
+        fields.add(juce::String(summary.maxShortTermLufs, 1));
+        fields.add(hasCorrelation ? juce::String(summary.meanCorrelation, 3) : juce::String());
+        fields.add(hasCorrelation ? juce::String(summary.minCorrelation, 3) : juce::String());
+        fields.add({});
+        
+        lines.add(fields.joinIntoString(","));
+    }
+    
+    return lines.joinIntoString("\n") + "\n";
+}
+
+}
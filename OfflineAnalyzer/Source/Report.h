@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    Report.h
+    Created: 18 Oct 2026 11:44:05pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "FileAnalysis.h"
+
+//==============================================================================
+/*
+The offline analysis results as JSON or CSV, one entry per file in the
+order the files were given.
+JSON has everything, histograms included:
+{ "analyzerVersion": n, "files": [ { "file": ..., "peakDb": [ per channel ], ..., "histograms": { ... } }, ... ] }
+CSV has one summary row per file, so a delivery can be checked in a spreadsheet.
+Files that couldn't be analysed are listed with their error.
+*/
+namespace Report
+{
+
+juce::var toJson(const std::vector<FileAnalysis>& analyses);
+
+juce::String toCsv(const std::vector<FileAnalysis>& analyses);
+
+}
@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    AnalysisFrame.h
+    Created: 18 Oct 2026 3:18:05pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "Globals.h"
+
+//==============================================================================
+enum Stream
+{
+    Main,
+    Reference, // sidechain bus
+    NumStreams
+};
+
+/*
+Everything measured over one display frame, for the main bus and the
+sidechain reference. Levels are laid out as lanes: the main bus channels
+start at lane 0 and the reference channels start at lane Globals::maxChannels.
+*/
+struct AnalysisFrame
+{
+    static constexpr int maxLanes = Globals::maxChannels * NumStreams;
+    
+    static int getLane(const Stream& stream, const int& channel) { return (stream * Globals::maxChannels) + channel; }
+    
+    std::array<int, NumStreams> numChannels { 0, 0 };
+    
+    // when the frame was completed, juce::Time::currentTimeMillis()
+    juce::int64 timeMs = 0;
+    
+    // samples analysed since prepare, up to the end of this frame
+    juce::int64 endSample = 0;
+    
+    // where the host timeline was at the end of this frame, -1 if the transport
+    // wasn't running or jumped part way through it
+    juce::int64 hostEndSample = -1;
+    
+    // in decibels
+    std::array<float, maxLanes> peakDb;
+    std::array<float, maxLanes> rmsDb;
+    
+    // -1 to +1, only measured while the analysis has subscribers
+    std::array<float, NumStreams> instantCorrelation;
+    std::array<float, NumStreams> averageCorrelation;
+    
+    // of the main bus in LUFS, while FrameAnalyzer was measuring it, minLufs otherwise
+    float momentaryLufs = -70.f;
+    float shortTermLufs = -70.f;
+};
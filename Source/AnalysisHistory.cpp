@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+
+    AnalysisHistory.cpp
+    Created: 18 Oct 2026 4:31:09pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "AnalysisHistory.h"
+#include <cstring>
+
+//==============================================================================
+void AnalysisHistory::push(const AnalysisFrame& frame)
+{
+    auto index = numWritten.load(std::memory_order_relaxed);
+    auto& slot = slots[index % capacity];
+    
+    Words words {};
+    std::memcpy(words.data(), &frame, sizeof(AnalysisFrame));
+    
+    // odd first, and fenced, so no reader can see a new word and an old sequence
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    
+    for ( size_t i = 0; i < numWords; ++i )
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    numWritten.store(index + 1, std::memory_order_release);
+}
+
+juce::uint64 AnalysisHistory::getOldestAvailable() const
+{
+    auto written = getNumWritten();
+    
+    // keep one slot of slack, the writer may be part way through it
+    return written > capacity - 1 ? written - (capacity - 1) : 0;
+}
+
+bool AnalysisHistory::read(const juce::uint64& index, AnalysisFrame& destination) const
+{
+    if ( index >= getNumWritten() || index < getOldestAvailable() )
+        return false;
+    
+    auto& slot = slots[index % capacity];
+    auto sequence = 2 * index + 2;
+    
+    if ( slot.sequence.load(std::memory_order_acquire) != sequence )
+        return false;
+    
+    Words words;
+    
+    for ( size_t i = 0; i < numWords; ++i )
+        words[i] = slot.words[i].load(std::memory_order_relaxed);
+    
+    // if the writer came round to this slot while it was being copied, the copy is torn
+    std::atomic_thread_fence(std::memory_order_acquire);
+    
+    if ( slot.sequence.load(std::memory_order_relaxed) != sequence )
+        return false;
+    
+    std::memcpy(static_cast<void*>(&destination), words.data(), sizeof(AnalysisFrame));
+    return true;
+}
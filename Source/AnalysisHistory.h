@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    AnalysisHistory.h
+    Created: 18 Oct 2026 4:31:09pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <type_traits>
+#include "AnalysisFrame.h"
+
+//==============================================================================
+/*
+The last few seconds of analysis frames, written by the audio thread and
+read by the message thread, the session timeline's writer and the other
+background followers, whenever they get round to it.
+There's one writer and it never waits: when it laps a slow reader the
+reader notices and skips ahead to the oldest frame still intact.
+Each slot is a seqlock. Its sequence is odd while the writer is in it and
+says which frame it holds once written, and the frame is kept as atomic
+words, so a reader that raced the writer sees the sequence change and
+throws its copy away instead of keeping a torn frame.
+*/
+struct AnalysisHistory
+{
+    // enough to refill a full histogram, ~19s at 40 frames per second
+    static constexpr juce::uint64 capacity = 800;
+    
+    // audio thread
+    void push(const AnalysisFrame& frame);
+    
+    // any other thread, each keeping its own place
+    juce::uint64 getNumWritten() const { return numWritten.load(std::memory_order_acquire); }
+    juce::uint64 getOldestAvailable() const;
+    bool read(const juce::uint64& index, AnalysisFrame& destination) const;
+
+private:
+    static_assert(std::is_trivially_copyable<AnalysisFrame>::value, "frames are copied as words");
+    
+    static constexpr size_t numWords = (sizeof(AnalysisFrame) + sizeof(juce::uint64) - 1) / sizeof(juce::uint64);
+    using Words = std::array<juce::uint64, numWords>;
+    
+    struct Slot
+    {
+        // 2 * index + 1 while frame index is being written, 2 * index + 2 once it's in
+        std::atomic<juce::uint64> sequence { 0 };
+        std::array<std::atomic<juce::uint64>, numWords> words {};
+    };
+    
+    std::array<Slot, capacity> slots;
+    std::atomic<juce::uint64> numWritten { 0 };
+};
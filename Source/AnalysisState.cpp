@@ -0,0 +1,144 @@
+/*
+  ==============================================================================
+
+    AnalysisState.cpp
+    Created: 18 Oct 2026 4:52:44pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "AnalysisState.h"
+
+namespace
+{
+
+float getMeanDb(const std::array<float, AnalysisFrame::maxLanes>& lanes, const AnalysisFrame& frame, const Stream& stream)
+{
+    auto count = frame.numChannels[stream];
+    
+    if ( count == 0 )
+        return Globals::negInf();
+    
+    auto firstLane = AnalysisFrame::getLane(stream, 0);
+    auto sum = 0.f;
+    
+    for ( auto ch = 0; ch < count; ++ch )
+        sum += lanes[firstLane + ch];
+    
+    return sum / count;
+}
+
+} // namespace
+
+//==============================================================================
+AnalysisState::~AnalysisState()
+{
+    stopFollowing();
+}
+
+bool AnalysisState::update(const juce::int64& nowMs)
+{
+    auto numWritten = history.getNumWritten();
+    auto consumedAny = false;
+    
+    // frames the audio thread has already overwritten are gone, start from the oldest left
+    auto oldestAvailable = history.getOldestAvailable();
+    
+    if ( oldestAvailable > nextFrame )
+    {
+        numDroppedFrames += oldestAvailable - nextFrame;
+        nextFrame = oldestAvailable;
+    }
+    
+    for ( ; nextFrame < numWritten; ++nextFrame )
+    {
+        if ( history.read(nextFrame, incomingFrame) )
+        {
+            consume(incomingFrame);
+            consumedAny = true;
+        }
+        else
+        {
+            ++numDroppedFrames;
+        }
+    }
+    
+    // no audio coming in, ticks still fall and holds still expire
+    if ( !consumedAny )
+        meters.advance(nowMs);
+    
+    return consumedAny;
+}
+
+void AnalysisState::consume(const AnalysisFrame& frame)
+{
+    // replayed frames carry their own time so holds expire as they would have live
+    meters.process(frame, frame.timeMs);
+    meters.advance(frame.timeMs);
+    
+    latestFrame = frame;
+}
+
+//==============================================================================
+void AnalysisState::startFollowing()
+{
+    if ( !follower.isThreadRunning() )
+        follower.startThread();
+}
+
+void AnalysisState::stopFollowing()
+{
+    follower.signalThreadShouldExit();
+    follower.notify();
+    follower.stopThread(2000);
+}
+
+void AnalysisState::Follower::run()
+{
+    while ( !threadShouldExit() )
+    {
+        state.updateLevels();
+        wait(pollIntervalMs);
+    }
+}
+
+void AnalysisState::updateLevels()
+{
+    auto numWritten = history.getNumWritten();
+    auto oldestAvailable = history.getOldestAvailable();
+    
+    // frames overwritten before the follower got to them still take up their time
+    if ( oldestAvailable > nextLevelFrame )
+    {
+        pushLevelGap(oldestAvailable - nextLevelFrame);
+        nextLevelFrame = oldestAvailable;
+    }
+    
+    for ( ; nextLevelFrame < numWritten; ++nextLevelFrame )
+    {
+        if ( history.read(nextLevelFrame, levelFrame) )
+            pushLevels(levelFrame);
+        else
+            pushLevelGap(1);
+    }
+}
+
+void AnalysisState::pushLevels(const AnalysisFrame& frame)
+{
+    // the same means the meters take, over the channels the audio thread measured
+    for ( auto stream : { Main, Reference } )
+    {
+        rmsHistory[stream].push(getMeanDb(frame.rmsDb, frame, stream));
+        peakHistory[stream].push(getMeanDb(frame.peakDb, frame, stream));
+    }
+}
+
+void AnalysisState::pushLevelGap(const juce::uint64& numFrames)
+{
+    for ( auto stream : { Main, Reference } )
+    {
+        rmsHistory[stream].pushGap(numFrames);
+        peakHistory[stream].pushGap(numFrames);
+    }
+}
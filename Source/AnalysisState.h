@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    AnalysisState.h
+    Created: 18 Oct 2026 4:52:44pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include "AnalysisFrame.h"
+#include "AnalysisHistory.h"
+#include "MeterAnalyzer.h"
+#include "LevelPyramid.h"
+
+//==============================================================================
+/*
+Everything the meters show, owned by the processor so it outlives the editor.
+The audio thread always measures levels into the history, which is cheap.
+The heavier work (correlation, true peak, loudness, copying audio for the
+goniometer) only runs while something is subscribed; loudness also while
+the session timeline or the position cache is running.
+Reopening the editor replays the history, so the meters pick up where they
+would have been. The level histories are kept by a follower thread of their
+own, started with the first editor, so from then on they cover the session
+whether or not the editor stays open.
+*/
+struct AnalysisState
+{
+    ~AnalysisState();
+    
+    // message thread; brings the meters up to date with everything measured
+    // since the last call, returns false if there was nothing new
+    bool update(const juce::int64& nowMs);
+    
+    // starts the follower if it isn't running yet. Not done on construction,
+    // so plugin scans don't start threads.
+    void startFollowing();
+    void stopFollowing();
+    
+    // what the follower does every pollIntervalMs: everything measured since,
+    // into the level histories. Only to be called while it isn't running.
+    void updateLevels();
+    
+    static constexpr int pollIntervalMs = 100;
+    
+    const AnalysisFrame& getLatestFrame() const { return latestFrame; }
+    
+    // frames overwritten before update() got to them, since construction
+    juce::uint64 getNumDroppedFrames() const { return numDroppedFrames; }
+    
+    // keeps the expensive analysis running for as long as it exists
+    struct Subscription
+    {
+        explicit Subscription(AnalysisState& s) : state(s) { ++state.numSubscribers; }
+        ~Subscription() { --state.numSubscribers; }
+    
+    private:
+        AnalysisState& state;
+        
+        JUCE_DECLARE_NON_COPYABLE(Subscription)
+    };
+    
+    bool hasSubscribers() const { return numSubscribers.load(std::memory_order_relaxed) > 0; }
+    
+    // written by the audio thread
+    AnalysisHistory history;
+    
+    MeterAnalyzer meters;
+    
+    // mean across channels in decibels, one value per frame, indexed by Stream;
+    // frames nobody got to in time are kept as Globals::negInf()
+    std::array<LevelPyramid, NumStreams> rmsHistory;
+    std::array<LevelPyramid, NumStreams> peakHistory;
+
+private:
+    struct Follower : juce::Thread
+    {
+        Follower(AnalysisState& s) : juce::Thread("Level history follower"), state(s) { }
+        void run() override;
+        
+        AnalysisState& state;
+    };
+    
+    void consume(const AnalysisFrame& frame);
+    
+    // follower thread
+    void pushLevels(const AnalysisFrame& frame);
+    void pushLevelGap(const juce::uint64& numFrames);
+    
+    juce::uint64 nextFrame = 0;
+    juce::uint64 numDroppedFrames = 0;
+    AnalysisFrame latestFrame;
+    AnalysisFrame incomingFrame;
+    
+    std::atomic<int> numSubscribers { 0 };
+    
+    // follower thread
+    juce::uint64 nextLevelFrame = 0;
+    AnalysisFrame levelFrame;
+    
+    Follower follower { *this };
+};
@@ -1,64 +1,99 @@
-/*
-  ==============================================================================
-
-    Averager.h
-    Created: 2 Apr 2022 12:53:25am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-//==============================================================================
-template<typename T>
-struct Averager
-{
-    Averager(size_t numElements, T initialValue)
-    {
-        resize(numElements, initialValue);
-    }
-
-    void clear(T initialValue)
-    {
-        container.assign(getSize(), initialValue);
-        
-        auto initSum = std::accumulate(container.begin(), container.end(), 0);
-        runningTotal = static_cast<float>(initSum);
-        
-        computeAverage();
-    }
-    
-    void resize(size_t s, T initialValue)
-    {
-        container.resize(s, initialValue);
-        clear(initialValue);
-    }
-
-    void add(T t)
-    {
-        auto idx = writeIndex.load();
-        auto sum = runningTotal.load();
-        
-        sum -= static_cast<float>(container[idx]);
-        container[idx] = t;
-        sum += static_cast<float>(container[idx]);
-        runningTotal = sum;
-        
-        writeIndex = (idx + 1) % getSize();
-        
-        computeAverage();
-    }
-    
-    float getAverage() const { return average.load(); }
-    
-    size_t getSize() const { return container.size(); }
-    
-    void computeAverage() { average = runningTotal.load() / getSize(); }
-    
-private:
-    std::vector<T> container;
-    std::atomic<int> writeIndex = 0;
-    std::atomic<float> runningTotal = 0.f;
-    std::atomic<float> average = 0.f;
-};
+/*
+  ==============================================================================
+
+    Averager.h
+    Created: 2 Apr 2022 12:53:25am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+//==============================================================================
+/*
+Running mean of the last getSize() values, for one writer thread and any readers.
+The window and the running sum belong to the writer: add(), clear() and resize()
+are only called from one thread (the audio thread, from prepare and process),
+so they need no synchronisation. Readers only ever see the mean, published as
+a single atomic after every add.
+resize() allocates, so it belongs in prepare, never in process.
+The sum is double with Neumaier compensation, so adding and removing values for
+hours doesn't leave rounding behind in it.
+*/
+template<typename T>
+struct Averager
+{
+    Averager(size_t numElements, T initialValue)
+    {
+        resize(numElements, initialValue);
+    }
+    
+    // writer thread
+    void clear(T initialValue)
+    {
+        container.assign(getSize(), initialValue);
+        
+        runningTotal = static_cast<double>(initialValue) * getSize();
+        compensation = 0.0;
+        writeIndex = 0;
+        
+        computeAverage();
+    }
+    
+    // writer thread, allocates
+    void resize(size_t s, T initialValue)
+    {
+        container.resize(s, initialValue);
+        clear(initialValue);
+    }
+    
+    // writer thread
+    void add(T t)
+    {
+        accumulate(-static_cast<double>(container[writeIndex]));
+        accumulate(static_cast<double>(t));
+        container[writeIndex] = t;
+        
+        ++writeIndex;
+        if ( writeIndex == getSize() )
+            writeIndex = 0;
+        
+        computeAverage();
+    }
+    
+    // any thread
+    float getAverage() const { return average.load(std::memory_order_acquire); }
+    
+    // writer thread
+    size_t getSize() const { return container.size(); }
+
+private:
+    void accumulate(const double& value)
+    {
+        auto sum = runningTotal + value;
+        
+        // keep the low order bits that the addition just lost
+        if ( std::abs(runningTotal) >= std::abs(value) )
+            compensation += (runningTotal - sum) + value;
+        else
+            compensation += (value - sum) + runningTotal;
+        
+        runningTotal = sum;
+    }
+    
+    void computeAverage()
+    {
+        average.store(static_cast<float>((runningTotal + compensation) / getSize()), std::memory_order_release);
+    }
+    
+    std::vector<T> container;
+    size_t writeIndex = 0;
+    double runningTotal = 0.0;
+    double compensation = 0.0;
+    std::atomic<float> average { 0.f };
+};
@@ -1,18 +1,18 @@
-/*
-  ==============================================================================
-
-    Channel.h
-    Created: 2 Apr 2022 1:06:52am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-//==============================================================================
-enum class Channel
-{
-    Left,
-    Right
-};
+/*
+  ==============================================================================
+
+    Channel.h
+    Created: 2 Apr 2022 1:06:52am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//==============================================================================
+enum class Channel
+{
+    Left,
+    Right
+};
@@ -1,53 +1,137 @@
-/*
-  ==============================================================================
-
-    CircularBuffer.h
-    Created: 2 Apr 2022 12:42:57am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-//==============================================================================
-template<typename T>
-struct CircularBuffer
-{
-    using DataType = std::vector<T>;
-    
-    CircularBuffer(size_t numElements, T initialValue)
-    {
-        resize(numElements, initialValue);
-    }
-    
-    void resize(size_t s, T fillValue) { buffer.resize(s, fillValue); }
-    void clear(T fillValue) { buffer.assign(getSize(), fillValue); }
-    
-    void write(T t)
-    {
-        auto idx = writeIndex.load();
-        buffer[idx] = t;
-        
-        // increment writeIndex
-        ++idx;
-        if ( idx > getSize() - 1 ) // end of container, circle back to start
-            idx = 0;
-        
-        writeIndex = idx;
-    }
-    
-    DataType& getData() { return buffer; }
-    
-    size_t getReadIndex() const
-    {
-        // writeIndex was incremented in write() so now points to oldest item
-        return writeIndex.load();
-    }
-    
-    size_t getSize() const { return buffer.size(); }
-    
-private:
-    DataType buffer;
-    std::atomic<int> writeIndex = 0;
-};
+/*
+  ==============================================================================
+
+    CircularBuffer.h
+    Created: 2 Apr 2022 12:42:57am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+//==============================================================================
+/*
+The last getSize() values written, for one writer thread and one reader thread.
+The size is fixed at construction, so nothing is ever reallocated under a reader.
+Every write is bracketed by a sequence number (odd while a write is in progress);
+read() copies the whole buffer and starts again if a write overlapped the copy,
+so a reader always gets a history that existed at one moment, never half of two.
+Writes come at display frame rate and a copy takes microseconds, so in practice
+read() goes round once.
+*/
+template<typename T>
+struct CircularBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value && std::atomic<T>::is_always_lock_free,
+                  "values are copied one atomic load at a time");
+    
+    CircularBuffer(size_t numElements, T initialValue)
+        : buffer(new std::atomic<T>[numElements]),
+          size(numElements)
+    {
+        clear(initialValue);
+    }
+    
+    // writer thread
+    void clear(T fillValue)
+    {
+        beginWrite();
+        
+        for ( size_t i = 0; i < size; ++i )
+            buffer[i].store(fillValue, std::memory_order_release);
+        
+        writeIndex.store(0, std::memory_order_release);
+        endWrite();
+    }
+    
+    // writer thread
+    void write(T t)
+    {
+        auto idx = writeIndex.load(std::memory_order_relaxed);
+        
+        beginWrite();
+        buffer[idx].store(t, std::memory_order_release);
+        
+        // increment writeIndex
+        ++idx;
+        if ( idx == size ) // end of container, circle back to start
+            idx = 0;
+        
+        writeIndex.store(idx, std::memory_order_release);
+        endWrite();
+    }
+    
+    // reader thread: copies all getSize() values into destination, oldest first
+    void read(T* destination) const
+    {
+        for ( ;; )
+        {
+            auto before = sequence.load(std::memory_order_acquire);
+            
+            if ( (before & 1) == 0 )
+            {
+                // writeIndex points at the oldest item
+                auto oldest = writeIndex.load(std::memory_order_acquire);
+                
+                for ( size_t i = 0; i < size; ++i )
+                    destination[i] = buffer[(oldest + i) % size].load(std::memory_order_acquire);
+                
+                if ( sequence.load(std::memory_order_relaxed) == before )
+                    return;
+            }
+            
+            std::this_thread::yield();
+        }
+    }
+    
+    // reader thread: the most recent value on its own
+    T getNewest() const
+    {
+        for ( ;; )
+        {
+            auto before = sequence.load(std::memory_order_acquire);
+            
+            if ( (before & 1) == 0 )
+            {
+                auto newest = (writeIndex.load(std::memory_order_acquire) + size - 1) % size;
+                auto value = buffer[newest].load(std::memory_order_acquire);
+                
+                if ( sequence.load(std::memory_order_relaxed) == before )
+                    return value;
+            }
+            
+            std::this_thread::yield();
+        }
+    }
+    
+    size_t getSize() const { return size; }
+
+private:
+    /*
+    The values are stored with release and loaded with acquire, so a reader that
+    sees any value from a write also sees the odd sequence number before it, and
+    knows to start again. No standalone fences, which ThreadSanitizer can't follow.
+    Only the writer changes the sequence, so it can read its own value relaxed.
+    */
+    void beginWrite()
+    {
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    
+    void endWrite()
+    {
+        sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+    
+    std::unique_ptr<std::atomic<T>[]> buffer;
+    size_t size;
+    std::atomic<size_t> writeIndex { 0 };
+    std::atomic<juce::uint64> sequence { 0 };
+};
@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    CorrelationAnalyzer.cpp
+    Created: 18 Oct 2026 3:25:51pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "CorrelationAnalyzer.h"
+
+//==============================================================================
+void CorrelationAnalyzer::prepare(const double& sampleRate, const int& blockSize, const int& readInterval)
+{
+    auto length = juce::jmax(1, blockSize);
+    factor = 1;
+    
+    // the averagers then always hold a whole number of groups, and a whole group is in when they're read
+    while ( sampleRate / (factor * 2) >= minimumAnalysisRate && length % (factor * 2) == 0 && readInterval % (factor * 2) == 0 )
+        factor *= 2;
+    
+    groupSum = 0.f;
+    groupLength = 0;
+    
+    auto averagerSize = static_cast<size_t>(length / factor);
+    instantaneousCorrelation.resize(averagerSize, 0.f);
+    averagedCorrelation.resize(averagerSize * 6, 0.f);
+}
+
+void CorrelationAnalyzer::process(const float* left, const float* right, const int& numSamples)
+{
+    for ( auto i = 0; i < numSamples; ++i )
+    {
+        // NaN and inf count as silence, as they always have
+        auto sampleL = std::isfinite(left[i]) ? left[i] : 0.f;
+        auto sampleR = std::isfinite(right[i]) ? right[i] : 0.f;
+        auto product = sampleL * sampleR;
+        
+        groupSum += product > 0.f ? 1.f : (product < 0.f ? -1.f : 0.f);
+        
+        if ( ++groupLength < factor )
+            continue;
+        
+        // the mean of a group of signs, which sums exactly
+        auto correlation = groupSum / static_cast<float>(factor);
+        instantaneousCorrelation.add(correlation);
+        averagedCorrelation.add(correlation);
+        
+        groupSum = 0.f;
+        groupLength = 0;
+    }
+}
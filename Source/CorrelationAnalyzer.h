@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    CorrelationAnalyzer.h
+    Created: 18 Oct 2026 3:25:51pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Averager.h"
+
+//==============================================================================
+/*
+Phase correlation between two channels, without any drawing.
+Each sample counts as the sign of L * R, which is all the original 100Hz
+integrator came to: an order 2 Hann windowed FIR, whose window zeroes all
+but its centre tap. Those signs are only ever averaged, over a block and
+over six, so they go into the averagers a group at a time, as the mean of
+each group of getFactor() samples. As long as the averages are read at the
+end of a group, that gives exactly what averaging every sample did.
+Everything is allocated in prepare() so process() is safe on the audio thread.
+*/
+struct CorrelationAnalyzer
+{
+    // groups are never longer than this rate allows
+    static constexpr double minimumAnalysisRate = 3000.0;
+    
+    // the averages are read every readInterval samples; groups are the longest
+    // power of two that divides both that and blockSize
+    void prepare(const double& sampleRate, const int& blockSize, const int& readInterval);
+    void process(const float* left, const float* right, const int& numSamples);
+    
+    float getInstantCorrelation() const { return instantaneousCorrelation.getAverage(); }
+    float getAverageCorrelation() const { return averagedCorrelation.getAverage(); }
+    
+    int getFactor() const { return factor; }
+
+private:
+    int factor = 1;
+    
+    // the group so far
+    float groupSum = 0.f;
+    int groupLength = 0;
+    
+    Averager<float> instantaneousCorrelation{ 1, 0.f };
+    Averager<float> averagedCorrelation{ 6, 0.f };
+};
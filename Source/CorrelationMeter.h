@@ -1,34 +1,38 @@
-/*
-  ==============================================================================
-
-    CorrelationMeter.h
-    Created: 2 Apr 2022 12:54:22am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "Averager.h"
-
-//==============================================================================
-struct CorrelationMeter : juce::Component
-{
-    CorrelationMeter(double _sampleRate, size_t _blockSize);
-    void prepareFilters();
-    void paint(juce::Graphics& g) override;
-    juce::Rectangle<int> paintMeter(const juce::Rectangle<int>& containerBounds, const int& y, const int& height, const float& value);
-    void update(juce::AudioBuffer<float>& incomingBuffer);
-    
-private:
-    using FilterType = juce::dsp::FIR::Filter<float>;
-    std::array<FilterType, 3> filters;
-    
-    double sampleRate;
-    size_t blockSize;
-    
-    Averager<float> instantaneousCorrelation{ blockSize, 0.f };
-    Averager<float> averagedCorrelation{ blockSize * 6, 0.f };
-};
+/*
+  ==============================================================================
+
+    CorrelationMeter.h
+    Created: 2 Apr 2022 12:54:22am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "AnalysisFrame.h"
+#include "SharedRenderResources.h"
+#include "FrameProfiler.h"
+
+//==============================================================================
+struct CorrelationMeter : juce::Component
+{
+    CorrelationMeter(FrameProfiler& p)
+        : profiler(p), profilerView(p.registerView(FrameProfiler::CorrelationMeterPaint, "correlation meter")) { }
+    
+    void paint(juce::Graphics& g) override;
+    juce::Rectangle<int> paintMeter(const juce::Rectangle<int>& containerBounds, const int& y, const int& height, const float& value);
+    void update(const AnalysisFrame& frame);
+    
+private:
+    void paintReferenceMarker(juce::Graphics& g, const juce::Rectangle<int>& meterBounds, const juce::Rectangle<int>& row, const float& value);
+    
+    std::array<float, NumStreams> instantaneousCorrelation { 0.f, 0.f };
+    std::array<float, NumStreams> averagedCorrelation { 0.f, 0.f };
+    bool hasReference = false;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+    FrameProfiler& profiler;
+    int profilerView;
+};
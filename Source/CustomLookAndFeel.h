@@ -1,50 +1,50 @@
-/*
-  ==============================================================================
-
-    CustomLookAndFeel.h
-    Created: 2 Apr 2022 1:09:01am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-
-//==============================================================================
-struct CustomLookAndFeel : juce::LookAndFeel_V4
-{
-    void drawLinearSlider(juce::Graphics& g,
-                          int x, int y, int width, int height,
-                          float sliderPos,
-                          float minSliderPos,
-                          float maxSliderPos,
-                          const juce::Slider::SliderStyle style,
-                          juce::Slider& slider) override;
-    
-    void drawComboBox(juce::Graphics& g,
-                      int width, int height,
-                      bool isButtonDown,
-                      int buttonX, int buttonY,
-                      int buttonW, int buttonH,
-                      juce::ComboBox& comboBox) override;
-    
-    void drawToggleButton(juce::Graphics& g,
-                          juce::ToggleButton& toggleButton,
-                          bool shouldDrawButtonAsHighlighted,
-                          bool shouldDrawButtonAsDown) override;
-    
-    void drawButtonBackground(juce::Graphics& g,
-                              juce::Button& button,
-                              const juce::Colour& backgroundColour,
-                              bool shouldDrawButtonAsHighlighted,
-                              bool shouldDrawButtonAsDown) override;
-    
-    void drawRotarySlider(juce::Graphics& g,
-                          int x, int y, int width, int height,
-                          float sliderPosProportional,
-                          float rotaryStartAngle,
-                          float rotaryEndAngle,
-                          juce::Slider& slider) override;
-};
+/*
+  ==============================================================================
+
+    CustomLookAndFeel.h
+    Created: 2 Apr 2022 1:09:01am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+struct CustomLookAndFeel : juce::LookAndFeel_V4
+{
+    void drawLinearSlider(juce::Graphics& g,
+                          int x, int y, int width, int height,
+                          float sliderPos,
+                          float minSliderPos,
+                          float maxSliderPos,
+                          const juce::Slider::SliderStyle style,
+                          juce::Slider& slider) override;
+    
+    void drawComboBox(juce::Graphics& g,
+                      int width, int height,
+                      bool isButtonDown,
+                      int buttonX, int buttonY,
+                      int buttonW, int buttonH,
+                      juce::ComboBox& comboBox) override;
+    
+    void drawToggleButton(juce::Graphics& g,
+                          juce::ToggleButton& toggleButton,
+                          bool shouldDrawButtonAsHighlighted,
+                          bool shouldDrawButtonAsDown) override;
+    
+    void drawButtonBackground(juce::Graphics& g,
+                              juce::Button& button,
+                              const juce::Colour& backgroundColour,
+                              bool shouldDrawButtonAsHighlighted,
+                              bool shouldDrawButtonAsDown) override;
+    
+    void drawRotarySlider(juce::Graphics& g,
+                          int x, int y, int width, int height,
+                          float sliderPosProportional,
+                          float rotaryStartAngle,
+                          float rotaryEndAngle,
+                          juce::Slider& slider) override;
+};
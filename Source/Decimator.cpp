@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    Decimator.cpp
+    Created: 19 Oct 2026 6:04:55am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "Decimator.h"
+#include <cmath>
+
+//==============================================================================
+void Decimator::prepare(const double& sampleRate, const double& minimumOutputRate)
+{
+    numStages = 0;
+    
+    while ( numStages < maxStages && sampleRate / (2 << numStages) >= minimumOutputRate )
+        ++numStages;
+    
+    // worked out here rather than by the audio thread the first time round
+    Stage<shortTapsPerSide>::getTaps();
+    Stage<longTapsPerSide>::getTaps();
+    
+    reset();
+}
+
+void Decimator::reset()
+{
+    for ( auto& stage : shortStages )
+        stage.reset();
+    
+    for ( auto& stage : longStages )
+        stage.reset();
+}
+
+double Decimator::getDelay() const
+{
+    auto delay = 0.0;
+    auto numShort = juce::jmax(0, numStages - numLongStages);
+    
+    // each stage's delay is in samples at its own input rate
+    for ( auto s = 0; s < numStages; ++s )
+        delay += (s < numShort ? Stage<shortTapsPerSide>::delay : Stage<longTapsPerSide>::delay) * static_cast<double>(1 << s);
+    
+    return delay;
+}
+
+int Decimator::process(const float* input, float* output, const int& numSamples)
+{
+    if ( numStages == 0 )
+    {
+        std::copy(input, input + numSamples, output);
+        return numSamples;
+    }
+    
+    // the long stages are always the last ones, at the lowest rates
+    auto numShort = juce::jmax(0, numStages - numLongStages);
+    auto numOutputs = 0;
+    
+    for ( auto start = 0; start < numSamples; start += chunkSize )
+    {
+        const auto* stageInput = input + start;
+        auto count = juce::jmin(chunkSize, numSamples - start);
+        
+        // each stage halves it, into whichever scratch buffer the last one didn't use
+        for ( auto s = 0; s < numStages; ++s )
+        {
+            auto isLast = s == numStages - 1;
+            auto* stageOutput = isLast ? output + numOutputs : scratch[static_cast<size_t>(s % 2)].data();
+            
+            count = s < numShort ? shortStages[static_cast<size_t>(s)].process(stageInput, stageOutput, count)
+                                 : longStages[static_cast<size_t>(s - numShort)].process(stageInput, stageOutput, count);
+            
+            stageInput = stageOutput;
+        }
+        
+        numOutputs += count;
+    }
+    
+    return numOutputs;
+}
+
+//==============================================================================
+template<int TapsPerSide>
+void Decimator::Stage<TapsPerSide>::reset()
+{
+    buffer.fill(0.f);
+    nextOutput = 1;
+}
+
+template<int TapsPerSide>
+const std::array<float, TapsPerSide>& Decimator::Stage<TapsPerSide>::getTaps()
+{
+    // Blackman windowed sinc cut off at half Nyquist, where every other tap is
+    // zero. Only the odd taps are kept, nearest the centre first, scaled so DC
+    // is unchanged. The window is two taps longer than the filter so that its
+    // zero end points fall on even taps, which are zero anyway; with one a side
+    // that comes to exactly [1/4 1/2 1/4]
+    static const auto taps = []
+    {
+        std::array<float, TapsPerSide> odd;
+        constexpr int length = 4 * TapsPerSide + 1;
+        auto sum = 0.0;
+        
+        for ( auto k = 0; k < TapsPerSide; ++k )
+        {
+            auto offset = 2 * k + 1;
+            auto x = juce::MathConstants<double>::pi * offset / 2.0;
+            auto n = (length - 1) / 2 + offset;
+            
+            auto window = 0.42 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * n / (length - 1))
+                        + 0.08 * std::cos(2.0 * juce::MathConstants<double>::twoPi * n / (length - 1));
+            
+            odd[k] = static_cast<float>(0.5 * std::sin(x) / x * window);
+            sum += 2.0 * odd[k];
+        }
+        
+        for ( auto& tap : odd )
+            tap = static_cast<float>(tap * 0.5 / sum);
+        
+        return odd;
+    }();
+    
+    return taps;
+}
+
+template<int TapsPerSide>
+int Decimator::Stage<TapsPerSide>::process(const float* input, float* output, const int& numSamples)
+{
+    const auto& taps = getTaps();
+    
+    std::copy(input, input + numSamples, buffer.begin() + historyLength);
+    
+    auto numOutputs = 0;
+    auto i = nextOutput;
+    
+    for ( ; i < numSamples; i += 2 )
+    {
+        const auto* centre = buffer.data() + historyLength + i - delay;
+        auto sum = 0.5f * centre[0];
+        
+        for ( auto k = 0; k < TapsPerSide; ++k )
+            sum += taps[static_cast<size_t>(k)] * (centre[-(2 * k + 1)] + centre[2 * k + 1]);
+        
+        output[numOutputs++] = sum;
+    }
+    
+    nextOutput = i - numSamples;
+    
+    std::copy(buffer.begin() + numSamples, buffer.begin() + numSamples + historyLength, buffer.begin());
+    
+    return numOutputs;
+}
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    Decimator.h
+    Created: 19 Oct 2026 6:04:55am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <array>
+
+//==============================================================================
+/*
+Reduces a stream to the lowest rate at or above a given minimum, by halving
+it through a cascade of polyphase half-band FIRs, for analysis that only
+looks at what's left far below Nyquist. Each stage only works out every
+other output, and half of its taps are zero.
+What folds down into the bottom of the band in the early stages comes from
+right next to their Nyquist, where even the 3 tap half-band [1/4 1/2 1/4]
+is over 45dB down, so only the last two stages need longer filters: 11
+taps, 7 of them non-zero, which keep everything that folds into the bottom
+200Hz of the output about 70dB down. The whole cascade costs less per input
+sample than a 3 tap FIR, whatever the factor.
+The stages keep their state between calls, so the input can be split
+however is convenient. Everything lives in the object, process() is safe on
+the audio thread.
+*/
+struct Decimator
+{
+    // 384kHz down to 6kHz
+    static constexpr int maxStages = 6;
+    
+    void prepare(const double& sampleRate, const double& minimumOutputRate);
+    void reset();
+    
+    int getFactor() const { return 1 << numStages; }
+    
+    // in input samples, how far the output lags behind the input
+    double getDelay() const;
+    
+    /*
+    Writes one output for every getFactor() inputs, taking the inputs left over
+    from the last call into account, and returns how many. output needs room
+    for numSamples / getFactor() + 1.
+    */
+    int process(const float* input, float* output, const int& numSamples);
+
+private:
+    static constexpr int chunkSize = 256;
+    
+    // non-zero taps each side of the centre
+    static constexpr int shortTapsPerSide = 1;
+    static constexpr int longTapsPerSide = 3;
+    static constexpr int numLongStages = 2;
+    
+    template<int TapsPerSide>
+    struct Stage
+    {
+        static constexpr int historyLength = 4 * TapsPerSide - 2;
+        
+        // the centre of the filter is this many samples behind the input
+        static constexpr int delay = 2 * TapsPerSide - 1;
+        
+        // the last historyLength inputs, then the chunk being worked on
+        std::array<float, historyLength + chunkSize> buffer {};
+        
+        // index into the chunk of the next input that has an output
+        int nextOutput = 1;
+        
+        void reset();
+        int process(const float* input, float* output, const int& numSamples);
+        
+        static const std::array<float, TapsPerSide>& getTaps();
+    };
+    
+    std::array<Stage<shortTapsPerSide>, maxStages - numLongStages> shortStages;
+    std::array<Stage<longTapsPerSide>, numLongStages> longStages;
+    int numStages = 0;
+    
+    std::array<std::array<float, chunkSize>, 2> scratch;
+};
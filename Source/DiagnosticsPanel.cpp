@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+
+    DiagnosticsPanel.cpp
+    Created: 18 Oct 2026 6:02:51pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "DiagnosticsPanel.h"
+#include "MyColours.h"
+
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+
+//==============================================================================
+DiagnosticsPanel::DiagnosticsPanel(RealtimeDiagnostics& d)
+    : diagnostics(d)
+{
+}
+
+void DiagnosticsPanel::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds();
+    
+    g.fillAll(MyColours::getColour(MyColours::Background).withAlpha(0.92f));
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.setFont(resources->getFont());
+    
+    auto lineHeight = 16;
+    auto textArea = bounds.reduced(10).removeFromLeft(bounds.getWidth() / 2);
+    
+    auto drawLine = [&](const juce::String& name, const juce::String& value)
+    {
+        auto line = textArea.removeFromTop(lineHeight);
+        g.drawText(name, line, juce::Justification::centredLeft);
+        g.drawText(value, line, juce::Justification::centredRight);
+    };
+    
+    auto percent = [](const float& value) { return juce::String(value, 1) + "%"; };
+    
+    drawLine("AUDIO THREAD", "click to reset");
+    textArea.removeFromTop(lineHeight / 2);
+    
+    drawLine("blocks",               juce::String(snapshot.numBlocks));
+    drawLine("deadline overruns",    juce::String(snapshot.numOverruns));
+    drawLine("load p50 / p99",       percent(snapshot.getLoadPercentile(0.5f)) + " / " + percent(snapshot.getLoadPercentile(0.99f)));
+    drawLine("load worst",           percent(snapshot.worstLoadPercent));
+    drawLine("allocations",          juce::String(snapshot.numAllocations));
+    drawLine("deallocations",        juce::String(snapshot.numDeallocations));
+    drawLine("blocks that allocate", juce::String(snapshot.numBlocksWithAllocations));
+    drawLine("blocking waits",       snapshot.numBlockingWaits < 0 ? juce::String("n/a") : juce::String(snapshot.numBlockingWaits));
+    drawLine("fifo overflows",       juce::String(snapshot.numFifoOverflows));
+    
+    paintLoadHistogram(g, bounds.reduced(10).removeFromRight(bounds.getWidth() / 2 - 20));
+}
+
+void DiagnosticsPanel::paintLoadHistogram(juce::Graphics& g, const juce::Rectangle<int>& area)
+{
+    auto labelHeight = 16;
+    auto plotArea = area.withTrimmedBottom(labelHeight);
+    auto binWidth = plotArea.getWidth() / static_cast<float>(RealtimeDiagnostics::numLoadBins);
+    
+    // counts span several orders of magnitude, a log scale keeps the rare slow blocks visible
+    auto largest = *std::max_element(snapshot.loadHistogram.begin(), snapshot.loadHistogram.end());
+    auto scale = std::log10(1.0 + largest);
+    
+    for ( auto bin = 0; bin < RealtimeDiagnostics::numLoadBins; ++bin )
+    {
+        auto count = snapshot.loadHistogram[bin];
+        if ( count == 0 || scale <= 0.0 )
+            continue;
+        
+        auto barHeight = static_cast<float>(plotArea.getHeight() * std::log10(1.0 + count) / scale);
+        auto overDeadline = (bin * RealtimeDiagnostics::percentPerLoadBin) >= 100;
+        
+        g.setColour(MyColours::getColour(overDeadline ? MyColours::Red : MyColours::GoniometerPath));
+        g.fillRect(juce::Rectangle<float>(plotArea.getX() + (bin * binWidth),
+                                          plotArea.getBottom() - barHeight,
+                                          binWidth - 1.f,
+                                          barHeight));
+    }
+    
+    auto labelArea = area.withTop(plotArea.getBottom());
+    auto maxPercent = RealtimeDiagnostics::numLoadBins * RealtimeDiagnostics::percentPerLoadBin;
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.drawText("0%", labelArea, juce::Justification::centredLeft);
+    g.drawText("load per block", labelArea, juce::Justification::centred);
+    g.drawText(juce::String(maxPercent) + "%+", labelArea, juce::Justification::centredRight);
+}
+
+void DiagnosticsPanel::mouseDown(const juce::MouseEvent&)
+{
+    diagnostics.reset();
+    timerCallback();
+}
+
+void DiagnosticsPanel::timerCallback()
+{
+    snapshot = diagnostics.getSnapshot();
+    repaint();
+}
+
+void DiagnosticsPanel::visibilityChanged()
+{
+    // only poll while someone is looking
+    if ( isVisible() )
+    {
+        timerCallback();
+        startTimerHz(4);
+    }
+    else
+    {
+        stopTimer();
+    }
+}
+
+#endif
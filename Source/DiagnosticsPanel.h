@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    DiagnosticsPanel.h
+    Created: 18 Oct 2026 6:02:51pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "RealtimeDiagnostics.h"
+#include "SharedRenderResources.h"
+
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+
+//==============================================================================
+/*
+Hidden overlay showing what the audio thread has been up to.
+Click it to start counting again.
+*/
+struct DiagnosticsPanel : juce::Component, juce::Timer
+{
+    DiagnosticsPanel(RealtimeDiagnostics& d);
+    
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent& e) override;
+    void timerCallback() override;
+    void visibilityChanged() override;
+
+private:
+    void paintLoadHistogram(juce::Graphics& g, const juce::Rectangle<int>& area);
+    
+    RealtimeDiagnostics& diagnostics;
+    RealtimeDiagnostics::Snapshot snapshot;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
+
+#endif
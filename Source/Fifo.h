@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    Fifo.h
+    Created: 18 Oct 2026 3:12:40pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+//==============================================================================
+/*
+Lock free single producer / single consumer queue of whole objects,
+used to hand data from the audio thread to the message thread.
+*/
+template<typename T, int Capacity = 10>
+struct Fifo
+{
+    // sizes every slot once, push() never reallocates afterwards
+    void prepare(int numSamples, int numChannels)
+    {
+        for ( auto& buffer : buffers)
+        {
+            buffer.setSize(numChannels, numSamples, false, true, true);
+            buffer.clear();
+        }
+        
+        slotSamples = numSamples;
+        slotChannels = numChannels;
+    }
+    
+    // blocks longer or wider than the slots keep their most recent samples and first channels
+    bool push(const T& t)
+    {
+        auto write = fifo.write(1);
+        if ( write.blockSize1 > 0 )
+        {
+            auto& slot = buffers[write.startIndex1];
+            auto numChannels = juce::jmin(t.getNumChannels(), slotChannels);
+            auto numSamples = juce::jmin(t.getNumSamples(), slotSamples);
+            
+            slot.setSize(numChannels, numSamples, false, false, true);
+            
+            for ( auto ch = 0; ch < numChannels; ++ch )
+                slot.copyFrom(ch, 0, t, ch, t.getNumSamples() - numSamples, numSamples);
+            
+            return true;
+        }
+        return false;
+    }
+    
+    bool pull(T& t)
+    {
+        auto read = fifo.read(1);
+        if ( read.blockSize1 > 0 )
+        {
+            t = buffers[read.startIndex1];
+            return true;
+        }
+        return false;
+    }
+    
+    int getNumAvailable() const
+    {
+        return fifo.getNumReady();
+    }
+
+private:
+    std::array<T, Capacity> buffers;
+    juce::AbstractFifo fifo{Capacity};
+    
+    int slotSamples = 0;
+    int slotChannels = 0;
+};
@@ -0,0 +1,192 @@
+/*
+  ==============================================================================
+
+    FrameAnalyzer.cpp
+    Created: 18 Oct 2026 3:40:17pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "FrameAnalyzer.h"
+#include "MeterBallistics.h"
+
+//==============================================================================
+void FrameAnalyzer::prepare(const double& sampleRate,
+                            const int& blockSize,
+                            const bool& measureLoudness,
+                            const juce::AudioChannelSet& mainLayout)
+{
+    frameLength = juce::jmax(1, juce::roundToInt(sampleRate / MeterBallistics::frameRateHz));
+    samplesInFrame = 0;
+    samplesAnalysed = 0;
+    hostPosition = -1;
+    frameOnTimeline = false;
+    
+    peak.fill(0.f);
+    sumOfSquares.fill(0.0);
+    
+    for ( auto& analyzer : correlation )
+        analyzer.prepare(sampleRate, blockSize, frameLength);
+    
+    loudnessEnabled = measureLoudness;
+    preparedSampleRate = sampleRate;
+    loudnessChannels = 0;
+    layoutChannels = mainLayout.size();
+    layoutWeights = LoudnessAnalyzer::getChannelWeights(mainLayout);
+    discreteWeights.fill(1.f);
+    frame.momentaryLufs = LoudnessAnalyzer::minLufs;
+    frame.shortTermLufs = LoudnessAnalyzer::minLufs;
+}
+
+void FrameAnalyzer::process(const juce::AudioBuffer<float>& main,
+                            const juce::AudioBuffer<float>& reference,
+                            AnalysisHistory& destination,
+                            const bool& measureCorrelation,
+                            const juce::int64& hostSample,
+                            const bool& measureLoudness)
+{
+    const juce::AudioBuffer<float>* streams[NumStreams] { &main, &reference };
+    
+    numActiveLanes = 0;
+    
+    for ( auto stream = 0; stream < NumStreams; ++stream )
+    {
+        auto numChannels = juce::jmin(streams[stream]->getNumChannels(), Globals::maxChannels);
+        frame.numChannels[stream] = numChannels;
+        
+        for ( auto ch = 0; ch < numChannels; ++ch )
+        {
+            lanePointers[numActiveLanes] = streams[stream]->getReadPointer(ch);
+            laneIndex[numActiveLanes] = AnalysisFrame::getLane(static_cast<Stream>(stream), ch);
+            ++numActiveLanes;
+        }
+    }
+    
+    // no allocation, only the filters are redesigned
+    if ( !loudnessEnabled || !measureLoudness )
+    {
+        loudnessChannels = 0;
+    }
+    else if ( frame.numChannels[Main] != loudnessChannels )
+    {
+        loudnessChannels = frame.numChannels[Main];
+        loudness.prepare(preparedSampleRate, loudnessChannels, loudnessChannels == layoutChannels ? layoutWeights : discreteWeights);
+    }
+    
+    // a frame is only placed on the timeline if the transport ran straight through it
+    if ( hostSample != hostPosition || hostSample < 0 )
+        frameOnTimeline = hostSample >= 0 && samplesInFrame == 0;
+    
+    hostPosition = hostSample;
+    
+    // hosts are free to send blocks longer than a frame, or frames may straddle blocks
+    auto numSamples = main.getNumSamples();
+    auto startSample = 0;
+    
+    while ( startSample < numSamples )
+    {
+        auto count = juce::jmin(numSamples - startSample, frameLength - samplesInFrame);
+        
+        accumulate(startSample, count);
+        
+        for ( auto stream = 0; stream < NumStreams; ++stream )
+        {
+            auto numChannels = frame.numChannels[stream];
+            if ( numChannels == 0 || !measureCorrelation )
+                continue;
+            
+            // mono buses are measured as L = R
+            auto* buffer = streams[stream];
+            correlation[stream].process(buffer->getReadPointer(0, startSample),
+                                        buffer->getReadPointer(juce::jmin(1, numChannels - 1), startSample),
+                                        count);
+        }
+        
+        if ( loudnessChannels > 0 )
+        {
+            for ( auto ch = 0; ch < loudnessChannels; ++ch )
+                loudnessPointers[ch] = main.getReadPointer(ch, startSample);
+            
+            loudness.process(loudnessPointers.data(), loudnessChannels, count);
+        }
+        
+        samplesInFrame += count;
+        samplesAnalysed += count;
+        startSample += count;
+        
+        if ( hostPosition >= 0 )
+            hostPosition += count;
+        
+        if ( samplesInFrame >= frameLength )
+            finishFrame(destination);
+    }
+}
+
+void FrameAnalyzer::accumulate(const int& startSample, const int& numSamples)
+{
+    // main and reference lanes go through the same loop, so the reference costs
+    // no more than a few extra channels would
+    for ( auto lane = 0; lane < numActiveLanes; ++lane )
+    {
+        auto* samples = lanePointers[lane] + startSample;
+        auto index = laneIndex[lane];
+        
+        auto magnitude = peak[index];
+        auto sum = sumOfSquares[index];
+        
+        for ( auto i = 0; i < numSamples; ++i )
+        {
+            auto s = samples[i];
+            magnitude = juce::jmax(magnitude, std::abs(s));
+            sum += s * s;
+        }
+        
+        peak[index] = magnitude;
+        sumOfSquares[index] = sum;
+    }
+}
+
+float FrameAnalyzer::toDecibels(const float& gain)
+{
+    // NaN reads as silence, inf as full scale, so a bad sample can't reach the meters
+    if ( std::isinf(gain) )
+        return Globals::maxDb();
+    
+    return juce::Decibels::gainToDecibels(gain, Globals::negInf());
+}
+
+void FrameAnalyzer::finishFrame(AnalysisHistory& destination)
+{
+    frame.peakDb.fill(Globals::negInf());
+    frame.rmsDb.fill(Globals::negInf());
+    
+    for ( auto lane = 0; lane < numActiveLanes; ++lane )
+    {
+        auto index = laneIndex[lane];
+        auto meanSquare = sumOfSquares[index] / samplesInFrame;
+        
+        frame.peakDb[index] = toDecibels(peak[index]);
+        frame.rmsDb[index] = toDecibels(static_cast<float>(std::sqrt(meanSquare)));
+    }
+    
+    for ( auto stream = 0; stream < NumStreams; ++stream )
+    {
+        frame.instantCorrelation[stream] = correlation[stream].getInstantCorrelation();
+        frame.averageCorrelation[stream] = correlation[stream].getAverageCorrelation();
+    }
+    
+    frame.momentaryLufs = loudnessChannels > 0 ? loudness.getMomentaryLufs() : LoudnessAnalyzer::minLufs;
+    frame.shortTermLufs = loudnessChannels > 0 ? loudness.getShortTermLufs() : LoudnessAnalyzer::minLufs;
+    
+    frame.timeMs = juce::Time::currentTimeMillis();
+    frame.endSample = samplesAnalysed;
+    frame.hostEndSample = frameOnTimeline ? hostPosition : -1;
+    destination.push(frame);
+    
+    frameOnTimeline = hostPosition >= 0;
+    
+    peak.fill(0.f);
+    sumOfSquares.fill(0.0);
+    samplesInFrame = 0;
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    FrameAnalyzer.h
+    Created: 18 Oct 2026 3:40:17pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "AnalysisFrame.h"
+#include "CorrelationAnalyzer.h"
+#include "AnalysisHistory.h"
+#include "LoudnessAnalyzer.h"
+
+//==============================================================================
+/*
+Audio thread side of the analysis.
+Collects peak, RMS and correlation for the main bus and the sidechain
+reference in one pass, and adds a finished AnalysisFrame to the history
+every display frame (1 / MeterBallistics::frameRateHz seconds of audio).
+Levels are always measured; correlation only when asked for, and
+loudness of the main bus only when asked for and prepared for it. Loudness
+starts afresh each time it's turned back on, and weights the channels by the
+main bus layout it was prepared with.
+*/
+struct FrameAnalyzer
+{
+    // mainLayout is the main bus layout (getChannelLayoutOfBus), in the order
+    // processBlock gets its channels; if the buffers turn out to have another
+    // width every channel is weighted 1
+    void prepare(const double& sampleRate,
+                 const int& blockSize,
+                 const bool& measureLoudness = false,
+                 const juce::AudioChannelSet& mainLayout = {});
+    
+    // reference may have no channels, e.g. when the sidechain bus is disabled.
+    // hostSample is the host timeline position of the first sample, -1 if unknown
+    void process(const juce::AudioBuffer<float>& main,
+                 const juce::AudioBuffer<float>& reference,
+                 AnalysisHistory& destination,
+                 const bool& measureCorrelation,
+                 const juce::int64& hostSample = -1,
+                 const bool& measureLoudness = true);
+
+private:
+    void accumulate(const int& startSample, const int& numSamples);
+    void finishFrame(AnalysisHistory& destination);
+    static float toDecibels(const float& gain);
+    
+    int frameLength = 1200;
+    int samplesInFrame = 0;
+    juce::int64 samplesAnalysed = 0;
+    
+    // the host timeline position of the next sample, and whether the frame so far is all of a piece
+    juce::int64 hostPosition = -1;
+    bool frameOnTimeline = false;
+    
+    // the channels of both streams, flattened into lanes for the accumulation pass
+    std::array<const float*, AnalysisFrame::maxLanes> lanePointers;
+    std::array<int, AnalysisFrame::maxLanes> laneIndex;
+    int numActiveLanes = 0;
+    
+    std::array<float, AnalysisFrame::maxLanes> peak;
+    std::array<double, AnalysisFrame::maxLanes> sumOfSquares;
+    
+    std::array<CorrelationAnalyzer, NumStreams> correlation;
+    
+    // prepared again whenever the main bus changes width or loudness is turned
+    // back on; loudnessChannels is 0 while it isn't being measured
+    LoudnessAnalyzer loudness;
+    bool loudnessEnabled = false;
+    double preparedSampleRate = 48000.0;
+    int loudnessChannels = 0;
+    std::array<const float*, Globals::maxChannels> loudnessPointers;
+    
+    // worked out in prepare() so the audio thread only copies them
+    int layoutChannels = 0;
+    std::array<float, Globals::maxChannels> layoutWeights;
+    std::array<float, Globals::maxChannels> discreteWeights;
+    
+    AnalysisFrame frame;
+};
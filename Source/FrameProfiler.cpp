@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    FrameProfiler.cpp
+    Created: 18 Oct 2026 6:41:37pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "FrameProfiler.h"
+
+//==============================================================================
+void FrameProfiler::setEnabled(const bool& shouldBeEnabled)
+{
+    enabled = shouldBeEnabled;
+    
+    // start every profiling session from a clean slate
+    for ( auto& window : windows )
+        window.clear();
+    
+    for ( auto& view : views )
+        view.window.clear();
+    
+    lastTickMs = 0.0;
+}
+
+void FrameProfiler::addSample(const Section& section, const double& milliseconds, const int& view)
+{
+    windows[section].add(milliseconds);
+    
+    if ( view >= 0 )
+        views[view].window.add(milliseconds);
+}
+
+int FrameProfiler::registerView(const Section& section, const juce::String& name)
+{
+    for ( size_t i = 0; i < views.size(); ++i )
+    {
+        if ( views[i].section == section && views[i].name == name )
+            return static_cast<int>(i);
+    }
+    
+    views.push_back({ section, name, {} });
+    return static_cast<int>(views.size()) - 1;
+}
+
+void FrameProfiler::markTimerTick()
+{
+    if ( !enabled )
+        return;
+    
+    auto nowMs = juce::Time::getMillisecondCounterHiRes();
+    
+    if ( lastTickMs > 0.0 )
+        addSample(TimerInterval, nowMs - lastTickMs);
+    
+    lastTickMs = nowMs;
+}
+
+const char* FrameProfiler::getSectionName(const Section& section)
+{
+    switch (section)
+    {
+        case MeterPaint:            return "Meter::paint";
+        case HistogramPaint:        return "Histogram::paint";
+        case GoniometerPaint:       return "Goniometer::paint";
+        case CorrelationMeterPaint: return "CorrelationMeter::paint";
+        case TimerCallback:         return "timerCallback";
+        case AnalysisUpdate:        return "AnalysisState::update";
+        case TimerInterval:         return "timer interval";
+        case NumSections:           break;
+    }
+    
+    return "";
+}
+
+FrameProfiler::Stats FrameProfiler::getStats(const Section& section) const
+{
+    return windows[section].getStats();
+}
+
+FrameProfiler::Stats FrameProfiler::getViewStats(const int& view) const
+{
+    return views[view].window.getStats();
+}
+
+//==============================================================================
+void FrameProfiler::Window::add(const double& milliseconds)
+{
+    samples[writeIndex] = milliseconds;
+    writeIndex = (writeIndex + 1) % windowSize;
+    count = juce::jmin(count + 1, windowSize);
+    totalMs += milliseconds;
+    ++totalCount;
+}
+
+void FrameProfiler::Window::clear()
+{
+    writeIndex = 0;
+    count = 0;
+    totalMs = 0.0;
+    totalCount = 0;
+}
+
+FrameProfiler::Stats FrameProfiler::Window::getStats() const
+{
+    Stats stats;
+    stats.count = count;
+    stats.totalMs = totalMs;
+    stats.totalCount = totalCount;
+    
+    if ( count == 0 )
+        return stats;
+    
+    // copy so the window keeps its order, only ever done for the overlay a few times a second
+    std::array<double, windowSize> sorted;
+    std::copy(samples.begin(), samples.begin() + count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + count);
+    
+    auto percentile = [&sorted, this](const double& fraction)
+    {
+        auto index = static_cast<int>(std::ceil(fraction * count)) - 1;
+        return sorted[juce::jlimit(0, count - 1, index)];
+    };
+    
+    stats.p50 = percentile(0.5);
+    stats.p99 = percentile(0.99);
+    stats.mean = std::accumulate(sorted.begin(), sorted.begin() + count, 0.0) / count;
+    
+    return stats;
+}
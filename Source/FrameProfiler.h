@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    FrameProfiler.h
+    Created: 18 Oct 2026 6:41:37pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+#include "TraceRecorder.h"
+
+//==============================================================================
+/*
+Message thread timings for the profiler overlay.
+Each editor owns one and hands it to the views it times, so editors open on
+several instances don't mix their numbers. Every view registers under a name
+of its own and is timed on its own as well as into its section, so the one
+view that blows the frame budget shows up rather than the average of all
+the meters. Nothing is recorded unless the overlay has switched it on, so a
+ScopedFrameTimer costs one bool check the rest of the time.
+*/
+struct FrameProfiler
+{
+    enum Section
+    {
+        MeterPaint,
+        HistogramPaint,
+        GoniometerPaint,
+        CorrelationMeterPaint,
+        TimerCallback,
+        AnalysisUpdate,
+        TimerInterval,
+        NumSections
+    };
+    
+    void setEnabled(const bool& shouldBeEnabled);
+    bool isEnabled() const { return enabled; }
+    
+    // view is an id from registerView, or -1 for a section with no view of its own
+    void addSample(const Section& section, const double& milliseconds, const int& view = -1);
+    
+    // call at the top of the editor's timer callback, records the time since the last call
+    void markTimerTick();
+    
+    static const char* getSectionName(const Section& section);
+    
+    TraceRecorder& getTracer() { return *tracer; }
+    
+    // over the last windowSize samples of a section
+    struct Stats
+    {
+        double p50 = 0.0;
+        double p99 = 0.0;
+        double mean = 0.0;
+        int count = 0;
+        
+        // everything since the profiler was enabled, not just the window
+        double totalMs = 0.0;
+        juce::int64 totalCount = 0;
+    };
+    
+    Stats getStats(const Section& section) const;
+    
+    /*
+    Message thread, from the view's constructor. Returns the id to time it by.
+    A view made again under the same name, as the meters are when the layout
+    changes, gets its old entry back.
+    */
+    int registerView(const Section& section, const juce::String& name);
+    
+    int getNumViews() const { return static_cast<int>(views.size()); }
+    const juce::String& getViewName(const int& view) const { return views[view].name; }
+    Section getViewSection(const int& view) const { return views[view].section; }
+    Stats getViewStats(const int& view) const;
+    
+    static constexpr int windowSize = 256;
+
+private:
+    struct Window
+    {
+        void add(const double& milliseconds);
+        void clear();
+        Stats getStats() const;
+        
+        std::array<double, windowSize> samples {};
+        int writeIndex = 0;
+        int count = 0;
+        
+        double totalMs = 0.0;
+        juce::int64 totalCount = 0;
+    };
+    
+    struct View
+    {
+        Section section;
+        juce::String name;
+        Window window;
+    };
+    
+    std::array<Window, NumSections> windows;
+    std::vector<View> views;
+    double lastTickMs = 0.0;
+    bool enabled = false;
+    
+    juce::SharedResourcePointer<TraceRecorder> tracer;
+};
+
+//==============================================================================
+// times the enclosing scope into a FrameProfiler section, or a registered view
+// and its section, and into the trace while one is recording
+struct ScopedFrameTimer
+{
+    ScopedFrameTimer(FrameProfiler& p, const FrameProfiler::Section& s)
+        : ScopedFrameTimer(p, s, -1)
+    {
+    }
+    
+    ScopedFrameTimer(FrameProfiler& p, const int& v)
+        : ScopedFrameTimer(p, p.getViewSection(v), v)
+    {
+    }
+    
+    ~ScopedFrameTimer()
+    {
+        if ( startTicks != 0 && profiler.isEnabled() )
+        {
+            auto elapsed = juce::Time::getHighResolutionTicks() - startTicks;
+            profiler.addSample(section, juce::Time::highResolutionTicksToSeconds(elapsed) * 1000.0, view);
+        }
+    }
+
+private:
+    ScopedFrameTimer(FrameProfiler& p, const FrameProfiler::Section& s, const int& v)
+        : profiler(p),
+          section(s),
+          view(v),
+          startTicks(p.isEnabled() ? juce::Time::getHighResolutionTicks() : 0),
+          traceEvent(p.getTracer(), FrameProfiler::getSectionName(s), "ui")
+    {
+    }
+    
+    FrameProfiler& profiler;
+    FrameProfiler::Section section;
+    int view;
+    juce::int64 startTicks;
+    TraceRecorder::ScopedEvent traceEvent;
+    
+    JUCE_DECLARE_NON_COPYABLE(ScopedFrameTimer)
+};
@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    FrameProfilerOverlay.cpp
+    Created: 18 Oct 2026 7:05:12pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "FrameProfilerOverlay.h"
+#include "MyColours.h"
+
+//==============================================================================
+FrameProfilerOverlay::FrameProfilerOverlay(FrameProfiler& p, const int& editorTimerHz)
+    : profiler(p),
+      frameBudgetMs(1000.0 / editorTimerHz)
+{
+    setInterceptsMouseClicks(false, false);
+}
+
+void FrameProfilerOverlay::paint(juce::Graphics& g)
+{
+    g.fillAll(MyColours::getColour(MyColours::Background).withAlpha(0.92f));
+    g.setFont(resources->getFont());
+    
+    auto area = getLocalBounds().reduced(10);
+    auto lineHeight = 16;
+    
+    auto ms = [](const double& value) { return juce::String(value, 2); };
+    
+    auto drawRow = [&](const juce::String& name, const juce::String& p50, const juce::String& p99, const bool& overBudget)
+    {
+        auto row = area.removeFromTop(lineHeight);
+        auto columnWidth = row.getWidth() / 5;
+        
+        g.setColour(MyColours::getColour(overBudget ? MyColours::RedBright : MyColours::Text));
+        g.drawText(name, row.removeFromLeft(columnWidth * 3), juce::Justification::centredLeft);
+        g.drawText(p50, row.removeFromLeft(columnWidth), juce::Justification::centredRight);
+        g.drawText(p99, row, juce::Justification::centredRight);
+    };
+    
+    drawRow("FRAME PROFILE (ms)", "p50", "p99", false);
+    area.removeFromTop(lineHeight / 2);
+    
+    // the timer's own work, then as many views as fit, slowest first; a view
+    // that eats the budget on its own is highlighted
+    for ( auto section : { FrameProfiler::TimerCallback, FrameProfiler::AnalysisUpdate } )
+    {
+        auto stats = profiler.getStats(section);
+        drawRow(FrameProfiler::getSectionName(section), ms(stats.p50), ms(stats.p99), stats.p99 > frameBudgetMs);
+    }
+    
+    area.removeFromTop(lineHeight / 2);
+    
+    std::vector<std::pair<FrameProfiler::Stats, int>> views;
+    
+    for ( auto view = 0; view < profiler.getNumViews(); ++view )
+    {
+        auto stats = profiler.getViewStats(view);
+        
+        // views that haven't painted since profiling started, e.g. of an earlier layout
+        if ( stats.count > 0 )
+            views.push_back({ stats, view });
+    }
+    
+    std::sort(views.begin(), views.end(), [](const auto& a, const auto& b) { return a.first.p99 > b.first.p99; });
+    
+    // keeping room for the two lines at the bottom
+    auto numRows = juce::jmin(static_cast<int>(views.size()), (area.getHeight() - lineHeight * 3) / lineHeight);
+    
+    for ( auto row = 0; row < numRows; ++row )
+    {
+        auto& stats = views[static_cast<size_t>(row)].first;
+        drawRow(profiler.getViewName(views[static_cast<size_t>(row)].second), ms(stats.p50), ms(stats.p99), stats.p99 > frameBudgetMs);
+    }
+    
+    area.removeFromTop(lineHeight / 2);
+    
+    auto interval = profiler.getStats(FrameProfiler::TimerInterval);
+    auto fps = interval.mean > 0.0 ? 1000.0 / interval.mean : 0.0;
+    
+    drawRow("timer jitter", ms(interval.p50 - frameBudgetMs), ms(interval.p99 - frameBudgetMs), interval.p99 > frameBudgetMs * 2.0);
+    drawRow("frame rate", juce::String(fps, 1), "", fps < (1000.0 / frameBudgetMs) * 0.9);
+}
+
+void FrameProfilerOverlay::timerCallback()
+{
+    repaint();
+}
+
+void FrameProfilerOverlay::visibilityChanged()
+{
+    profiler.setEnabled(isVisible());
+    
+    if ( isVisible() )
+        startTimerHz(4);
+    else
+        stopTimer();
+}
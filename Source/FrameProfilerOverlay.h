@@ -0,0 +1,35 @@
+/*
+  ==============================================================================
+
+    FrameProfilerOverlay.h
+    Created: 18 Oct 2026 7:05:12pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FrameProfiler.h"
+#include "SharedRenderResources.h"
+
+//==============================================================================
+/*
+Paint and timer statistics from the editor's FrameProfiler, drawn over the editor.
+Profiling only runs while this is visible.
+*/
+struct FrameProfilerOverlay : juce::Component, juce::Timer
+{
+    FrameProfilerOverlay(FrameProfiler& profiler, const int& editorTimerHz);
+    
+    void paint(juce::Graphics& g) override;
+    void timerCallback() override;
+    void visibilityChanged() override;
+
+private:
+    FrameProfiler& profiler;
+    double frameBudgetMs;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
@@ -0,0 +1,176 @@
+/*
+  ==============================================================================
+
+    GlyphAtlas.cpp
+    Created: 18 Oct 2026 9:12:40am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "GlyphAtlas.h"
+#include <cmath>
+
+//==============================================================================
+void GlyphAtlas::prepare(const juce::Font& newFont, const float& newScale)
+{
+    font = newFont;
+    scale = newScale;
+    
+    // monospaced font, so every character occupies the width of a zero
+    cellWidth = static_cast<int>(std::ceil(font.getStringWidthFloat("0")));
+    cellHeight = static_cast<int>(std::ceil(font.getHeight()));
+    physicalCellWidth = juce::roundToInt(cellWidth * scale);
+    physicalCellHeight = juce::roundToInt(cellHeight * scale);
+    
+    // "inf" takes three cells, everything else takes one
+    auto numCells = (NumGlyphs - 1) + getNumCells(Inf);
+    
+    atlas = juce::Image(juce::Image::SingleChannel,
+                        physicalCellWidth * numCells,
+                        physicalCellHeight,
+                        true);
+    
+    juce::Graphics g (atlas);
+    g.addTransform(juce::AffineTransform::scale(scale));
+    g.setColour(juce::Colours::white);
+    g.setFont(font);
+    
+    const char* glyphText[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "+", "-", ".", "inf" };
+    
+    for ( auto i = 0; i < NumGlyphs; ++i )
+    {
+        auto glyph = static_cast<Glyph>(i);
+        g.drawText(glyphText[i],                       // text
+                   getFirstCell(glyph) * cellWidth,    // x
+                   0,                                  // y
+                   getNumCells(glyph) * cellWidth,     // width
+                   cellHeight,                         // height
+                   juce::Justification::centred,       // justification
+                   false);                             // use ellipses
+    }
+}
+
+bool GlyphAtlas::isPreparedFor(const juce::Font& otherFont, const float& otherScale) const
+{
+    return atlas.isValid() && scale == otherScale && font == otherFont;
+}
+
+void GlyphAtlas::drawValue(juce::Graphics& g,
+                           const float& value,
+                           const int& numDecimalPlaces,
+                           const bool& showPlusSign,
+                           const juce::Rectangle<int>& area,
+                           const juce::Justification& justification) const
+{
+    GlyphRun run;
+    auto numGlyphs = layoutValue(value, numDecimalPlaces, showPlusSign, run);
+    drawRun(g, run, numGlyphs, area, justification);
+}
+
+void GlyphAtlas::drawNegativeInfinity(juce::Graphics& g,
+                                      const juce::Rectangle<int>& area,
+                                      const juce::Justification& justification) const
+{
+    GlyphRun run;
+    run[0] = Minus;
+    run[1] = Inf;
+    drawRun(g, run, 2, area, justification);
+}
+
+int GlyphAtlas::layoutValue(float value, int numDecimalPlaces, bool showPlusSign, GlyphRun& run)
+{
+    static constexpr int powersOfTen[] = { 1, 10, 100, 1000 };
+    numDecimalPlaces = juce::jlimit(0, 3, numDecimalPlaces);
+    auto multiplier = powersOfTen[numDecimalPlaces];
+    
+    // converting these to an integer is undefined, so they never get that far
+    if ( std::isnan(value) )
+    {
+        run[0] = Minus;
+        run[1] = Minus;
+        return 2;
+    }
+    
+    if ( std::isinf(value) )
+    {
+        auto numGlyphs = 0;
+        
+        if ( value < 0.f )
+            run[numGlyphs++] = Minus;
+        else if ( showPlusSign )
+            run[numGlyphs++] = Plus;
+        
+        run[numGlyphs++] = Inf;
+        return numGlyphs;
+    }
+    
+    // keep within what fits in the run (sign + 6 integer digits + point + decimals)
+    auto magnitude = juce::jmin(std::abs(value), 999999.f);
+    auto scaled = static_cast<juce::int64>(magnitude * multiplier + 0.5f);
+    auto integerPart = scaled / multiplier;
+    auto fractionalPart = scaled % multiplier;
+    
+    auto numGlyphs = 0;
+    
+    if ( value < 0.f && scaled != 0 )
+        run[numGlyphs++] = Minus;
+    else if ( showPlusSign && scaled != 0 )
+        run[numGlyphs++] = Plus;
+    
+    // integer digits are produced least significant first, then reversed in place
+    auto firstDigit = numGlyphs;
+    do
+    {
+        run[numGlyphs++] = static_cast<Glyph>(integerPart % 10);
+        integerPart /= 10;
+    }
+    while ( integerPart > 0 );
+    
+    std::reverse(run.begin() + firstDigit, run.begin() + numGlyphs);
+    
+    if ( numDecimalPlaces > 0 )
+    {
+        run[numGlyphs++] = Point;
+        
+        for ( auto divisor = multiplier / 10; divisor > 0; divisor /= 10 )
+            run[numGlyphs++] = static_cast<Glyph>((fractionalPart / divisor) % 10);
+    }
+    
+    return numGlyphs;
+}
+
+void GlyphAtlas::drawRun(juce::Graphics& g,
+                         const GlyphRun& run,
+                         const int& numGlyphs,
+                         const juce::Rectangle<int>& area,
+                         const juce::Justification& justification) const
+{
+    jassert(atlas.isValid()); // call prepare() before drawing
+    
+    auto numCells = 0;
+    for ( auto i = 0; i < numGlyphs; ++i )
+        numCells += getNumCells(run[i]);
+    
+    auto runBounds = justification.appliedToRectangle(juce::Rectangle<int>(numCells * cellWidth, cellHeight), area);
+    auto x = runBounds.getX();
+    
+    for ( auto i = 0; i < numGlyphs; ++i )
+    {
+        auto glyph = run[i];
+        auto width = getNumCells(glyph) * cellWidth;
+        
+        g.drawImage(atlas,
+                    x,                                             // dest x
+                    runBounds.getY(),                              // dest y
+                    width,                                         // dest width
+                    cellHeight,                                    // dest height
+                    getFirstCell(glyph) * physicalCellWidth,       // source x
+                    0,                                             // source y
+                    getNumCells(glyph) * physicalCellWidth,        // source width
+                    physicalCellHeight,                            // source height
+                    true);                                         // fill alpha channel with current brush
+        
+        x += width;
+    }
+}
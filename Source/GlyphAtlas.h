@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    GlyphAtlas.h
+    Created: 18 Oct 2026 9:12:40am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+//==============================================================================
+/*
+Fixed-width numeric renderer.
+Digits, signs, the decimal point and "-inf" are drawn once per font and scale
+into a single channel atlas image. Readouts are composed by blitting cells from
+that atlas with the current colour, so no string formatting or text layout
+happens per frame.
+*/
+struct GlyphAtlas
+{
+    void prepare(const juce::Font& newFont, const float& newScale);
+    bool isPreparedFor(const juce::Font& otherFont, const float& otherScale) const;
+    
+    void drawValue(juce::Graphics& g,
+                   const float& value,
+                   const int& numDecimalPlaces,
+                   const bool& showPlusSign,
+                   const juce::Rectangle<int>& area,
+                   const juce::Justification& justification) const;
+    
+    void drawNegativeInfinity(juce::Graphics& g,
+                              const juce::Rectangle<int>& area,
+                              const juce::Justification& justification) const;
+
+private:
+    enum Glyph : uint8_t
+    {
+        Zero, One, Two, Three, Four, Five, Six, Seven, Eight, Nine,
+        Plus,
+        Minus,
+        Point,
+        Inf,
+        NumGlyphs
+    };
+    
+    static constexpr int maxGlyphs = 12;
+    using GlyphRun = std::array<Glyph, maxGlyphs>;
+    
+    // infinities come out as "-inf" or "inf" ("+inf" with showPlusSign), NaN as "--"
+    static int layoutValue(float value, int numDecimalPlaces, bool showPlusSign, GlyphRun& run);
+    
+    void drawRun(juce::Graphics& g,
+                 const GlyphRun& run,
+                 const int& numGlyphs,
+                 const juce::Rectangle<int>& area,
+                 const juce::Justification& justification) const;
+    
+    static int getNumCells(Glyph glyph) { return glyph == Inf ? 3 : 1; }
+    static int getFirstCell(Glyph glyph) { return static_cast<int>(glyph); }
+    
+    juce::Image atlas;
+    juce::Font font;
+    float scale = 0.f;
+    
+    int cellWidth = 0;  // logical pixels
+    int cellHeight = 0; // logical pixels
+    int physicalCellWidth = 0;
+    int physicalCellHeight = 0;
+};
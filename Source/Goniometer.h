@@ -1,28 +1,37 @@
-/*
-  ==============================================================================
-
-    Goniometer.h
-    Created: 2 Apr 2022 12:33:09am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-
-//==============================================================================
-struct Goniometer : juce::Component
-{
-    void paint(juce::Graphics& g) override;
-    void resized() override;
-    void update(juce::AudioBuffer<float>& incomingBuffer);
-    void setScale(const double& rotaryValue);
-
-private:
-    juce::Image canvas;
-    juce::AudioBuffer<float> buffer;
-    
-    double scale;
-};
+/*
+  ==============================================================================
+
+    Goniometer.h
+    Created: 2 Apr 2022 12:33:09am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SharedRenderResources.h"
+#include "FrameProfiler.h"
+
+//==============================================================================
+struct Goniometer : juce::Component
+{
+    Goniometer(FrameProfiler& p)
+        : profiler(p), profilerView(p.registerView(FrameProfiler::GoniometerPaint, "goniometer")) { }
+    
+    void paint(juce::Graphics& g) override;
+    void update(juce::AudioBuffer<float>& incomingBuffer);
+    void setScale(const double& rotaryValue);
+
+private:
+    void drawGraticule(juce::Graphics& g, const int& width, const int& height);
+    
+    juce::AudioBuffer<float> buffer;
+    
+    double scale;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+    FrameProfiler& profiler;
+    int profilerView;
+};
@@ -1,120 +1,178 @@
-/*
-  ==============================================================================
-
-    Histogram.cpp
-    Created: 2 Apr 2022 12:44:53am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#include "Histogram.h"
-#include "MyColours.h"
-#include "Globals.h"
-
-//==============================================================================
-void Histogram::paint(juce::Graphics& g)
-{
-    auto bounds = getLocalBounds();
-    auto height = bounds.getHeight();
-    auto width = bounds.getWidth();
-    
-    /*
-    Filling the entire container with the gradient and threshold colours
-    The path to fill is the negative of the buffer data
-    That path hides anything not from the proper signal with "Background Colour"
-    */
-    auto gradient = MyColours::getMeterGradient(bounds.getHeight(), 0, MyColours::GradientOrientation::Vertical);
-    
-    g.setGradientFill(gradient);
-    g.fillAll();
-
-    auto mappedThresh = juce::jmap<float>(threshold.getValue(),
-                                          Globals::negInf(),
-                                          Globals::maxDb(),
-                                          bounds.getHeight(),
-                                          0);
-    
-    juce::Rectangle<float> redRect (0,
-                                    0,
-                                    bounds.getWidth(),
-                                    mappedThresh);
-    
-    g.setColour(MyColours::getColour(MyColours::Red));
-    g.fillRect(redRect);
-    
-    auto& data = circularBuffer.getData();
-    auto readIdx = circularBuffer.getReadIndex();
-    auto bufferSize = circularBuffer.getSize();
-
-    if ( view == HistView::columns )
-    {
-        readIdx = (readIdx + (bufferSize / 2)) % bufferSize;
-    }
-    
-    g.setColour(MyColours::getColour(MyColours::Background));
-    juce::Path p;
-    
-    // manually setting first and last pixel's column (x) outside of the loops
-    p.startNewSubPath(0, 0);
-    
-    auto x = 1;
-    
-    for ( auto i = readIdx; i < bufferSize - 1; ++i )
-    {
-        auto scaledValue = juce::jmap<float>(data[i], Globals::negInf(), Globals::maxDb(), height, 0);
-        
-        p.lineTo(x, scaledValue);
-        
-        ++x;
-    }
-
-    for ( auto j = 0; j < readIdx; ++j )
-    {
-        
-        auto scaledValue = juce::jmap<float>(data[j], Globals::negInf(), Globals::maxDb(), height, 0);
-        
-        p.lineTo(x, scaledValue);
-
-        ++x;
-    }
-    
-    p.lineTo(bufferSize - 1, 0);
-    p.closeSubPath();
-    g.fillPath(p);
-    
-    g.setColour(MyColours::getColour(MyColours::Text));
-    g.setFont(Globals::font());
-    g.drawFittedText(label,                           // text
-                     bounds.reduced(4),               // area
-                     juce::Justification::centredTop, // justification
-                     1);                              // max num lines
-    
-    
-    g.setColour(MyColours::getColour(MyColours::Background).contrasting(0.05f));
-    // startX, startY, endX, endY, thickness
-    g.drawLine(0, 0, 0, height, 2.f);
-    g.drawLine(width, 0, width, height, 2.f);
-    
-    g.drawLine(0, 0, width, 0, 2.f);
-    g.drawLine(0, height, width, height, 2.f);
-}
-
-void Histogram::update(const float& inputL, const float& inputR)
-{
-    auto average = (inputL + inputR) / 2;
-    circularBuffer.write(average);
-    
-    repaint();
-}
-
-void Histogram::setThreshold(const float& threshAsDecibels)
-{
-    threshold.setValue(threshAsDecibels);
-}
-
-void Histogram::setView(const HistView& v)
-{
-    view = v;
-    repaint();
-}
+/*
+  ==============================================================================
+
+    Histogram.cpp
+    Created: 2 Apr 2022 12:44:53am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "Histogram.h"
+#include "MyColours.h"
+#include "Globals.h"
+#include "MeterBallistics.h"
+
+//==============================================================================
+void Histogram::paint(juce::Graphics& g)
+{
+    ScopedFrameTimer frameTimer(profiler, profilerView);
+    
+    auto bounds = getLocalBounds();
+    auto height = bounds.getHeight();
+    auto width = bounds.getWidth();
+    
+    /*
+    Filling the entire container with the gradient and threshold colours
+    The path to fill is the negative of the buffer data
+    That path hides anything not from the proper signal with "Background Colour"
+    */
+    auto gradient = resources->getMeterGradient(bounds.getHeight(), 0, MyColours::GradientOrientation::Vertical);
+    
+    g.setGradientFill(*gradient);
+    g.fillAll();
+
+    auto mappedThresh = juce::jmap<float>(threshold.getValue(),
+                                          Globals::negInf(),
+                                          Globals::maxDb(),
+                                          bounds.getHeight(),
+                                          0);
+    
+    juce::Rectangle<float> redRect (0,
+                                    0,
+                                    bounds.getWidth(),
+                                    mappedThresh);
+    
+    g.setColour(MyColours::getColour(MyColours::Red));
+    g.fillRect(redRect);
+    
+    // both histories are read once per paint, at the same zoom, oldest first,
+    // so in either view the newest column is at the right hand edge
+    auto bufferSize = static_cast<int>(columns.size());
+    history.read(columns.data(), bufferSize, framesPerColumn);
+    referenceHistory.read(referenceColumns.data(), bufferSize, framesPerColumn);
+    
+    g.setColour(MyColours::getColour(MyColours::Background));
+    juce::Path p;
+    
+    // manually setting first and last pixel's column (x) outside of the loop
+    p.startNewSubPath(0, 0);
+    
+    for ( auto x = 1; x < bufferSize; ++x )
+    {
+        auto scaledValue = juce::jmap<float>(columns[x].max, Globals::negInf(), Globals::maxDb(), height, 0);
+        
+        p.lineTo(x, scaledValue);
+    }
+    
+    p.lineTo(bufferSize - 1, 0);
+    p.closeSubPath();
+    g.fillPath(p);
+    
+    paintReference(g, height);
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.setFont(resources->getFont());
+    g.drawFittedText(getLabelText(),                  // text
+                     bounds.reduced(4),               // area
+                     juce::Justification::centredTop, // justification
+                     1);                              // max num lines
+    
+    
+    g.setColour(MyColours::getColour(MyColours::Background).contrasting(0.05f));
+    // startX, startY, endX, endY, thickness
+    g.drawLine(0, 0, 0, height, 2.f);
+    g.drawLine(width, 0, width, height, 2.f);
+    
+    g.drawLine(0, 0, width, 0, 2.f);
+    g.drawLine(0, height, width, height, 2.f);
+}
+
+void Histogram::paintReference(juce::Graphics& g, const int& height)
+{
+    auto bufferSize = static_cast<int>(referenceColumns.size());
+    
+    juce::Path p;
+    auto penDown = false;
+    
+    // same column order as the main trace, broken wherever the reference is silent
+    for ( auto x = 1; x < bufferSize; ++x )
+    {
+        auto value = referenceColumns[x].mean;
+        
+        if ( value <= Globals::negInf() )
+        {
+            penDown = false;
+            continue;
+        }
+        
+        auto scaledValue = juce::jmap<float>(value, Globals::negInf(), Globals::maxDb(), height, 0);
+        
+        if ( penDown )
+            p.lineTo(x, scaledValue);
+        else
+            p.startNewSubPath(x, scaledValue);
+        
+        penDown = true;
+    }
+    
+    if ( p.isEmpty() )
+        return;
+    
+    g.setColour(MyColours::getColour(MyColours::Reference));
+    g.strokePath(p, juce::PathStrokeType(1.5f));
+}
+
+void Histogram::resized()
+{
+    // one column per pixel, sized here so paint() never allocates
+    auto numColumns = static_cast<size_t>(juce::jmax(1, getWidth()));
+    columns.resize(numColumns);
+    referenceColumns.resize(numColumns);
+}
+
+void Histogram::mouseWheelMove(const juce::MouseEvent&, const juce::MouseWheelDetails& wheel)
+{
+    // twice or half the history per notch, from one frame per column to all of it
+    auto maxFramesPerColumn = juce::jmax<juce::uint64>(1, LevelPyramid::getMaxSpan() / columns.size());
+    
+    if ( wheel.deltaY < 0.f )
+        framesPerColumn = juce::jmin(framesPerColumn * 2, maxFramesPerColumn);
+    else if ( wheel.deltaY > 0.f )
+        framesPerColumn = juce::jmax<juce::uint64>(1, framesPerColumn / 2);
+    
+    repaint();
+}
+
+void Histogram::mouseDoubleClick(const juce::MouseEvent&)
+{
+    framesPerColumn = 1;
+    repaint();
+}
+
+juce::String Histogram::getLabelText() const
+{
+    if ( framesPerColumn == 1 )
+        return label;
+    
+    auto seconds = static_cast<double>(columns.size() * framesPerColumn) / MeterBallistics::frameRateHz;
+    
+    if ( seconds < 120.0 )
+        return label + " (" + juce::String(juce::roundToInt(seconds)) + "s)";
+    
+    if ( seconds < 7200.0 )
+        return label + " (" + juce::String(juce::roundToInt(seconds / 60.0)) + " min)";
+    
+    return label + " (" + juce::String(seconds / 3600.0, 1) + " h)";
+}
+
+void Histogram::setThreshold(const float& threshAsDecibels)
+{
+    threshold.setValue(threshAsDecibels);
+}
+
+void Histogram::setView(const HistView& v)
+{
+    view = v;
+    repaint();
+}
@@ -1,35 +1,72 @@
-/*
-  ==============================================================================
-
-    Histogram.h
-    Created: 2 Apr 2022 12:44:53am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "HistogramEnums.h"
-#include "CircularBuffer.h"
-
-//==============================================================================
-struct Histogram : juce::Component
-{
-    Histogram(const juce::String& _label) : label(_label) { }
-    void paint(juce::Graphics& g) override;
-    void update(const float& inputL, const float& inputR);
-    
-    void setThreshold(const float& threshAsDecibels);
-    void setView(const HistView& v);
-    juce::Value& getThresholdValueObject() { return threshold; }
-    
-private:
-    CircularBuffer<float> circularBuffer{776, -48.f};
-    
-    juce::String label;
-    juce::Value threshold;
-    
-    HistView view;
-};
+/*
+  ==============================================================================
+
+    Histogram.h
+    Created: 2 Apr 2022 12:44:53am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "HistogramEnums.h"
+#include "LevelPyramid.h"
+#include "SharedRenderResources.h"
+#include "FrameProfiler.h"
+
+//==============================================================================
+/*
+One column per pixel, one frame per column to start with. The mouse wheel
+zooms out to several frames per column, up to the whole of the history, and
+a double click goes back. Zoomed out, a column is filled to the loudest
+frame it covers, so short peaks still show, and the reference is drawn
+through the mean.
+*/
+struct Histogram : juce::Component
+{
+    // draws the histories in place, they belong to the processor
+    Histogram(const juce::String& _label,
+              const LevelPyramid& _history,
+              const LevelPyramid& _referenceHistory,
+              FrameProfiler& _profiler)
+        : history(_history),
+          referenceHistory(_referenceHistory),
+          label(_label),
+          profiler(_profiler),
+          profilerView(_profiler.registerView(FrameProfiler::HistogramPaint, _label + " histogram")) { }
+    
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    
+    void mouseWheelMove(const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel) override;
+    void mouseDoubleClick(const juce::MouseEvent& e) override;
+    
+    void setThreshold(const float& threshAsDecibels);
+    void setView(const HistView& v);
+    juce::Value& getThresholdValueObject() { return threshold; }
+    
+private:
+    void paintReference(juce::Graphics& g, const int& height);
+    
+    juce::String getLabelText() const;
+    
+    const LevelPyramid& history;
+    const LevelPyramid& referenceHistory; // sidechain, -48 while absent
+    
+    // what paint() draws, read out of the histories, oldest first
+    std::vector<LevelPyramid::Bucket> columns;
+    std::vector<LevelPyramid::Bucket> referenceColumns;
+    
+    juce::uint64 framesPerColumn = 1;
+    
+    juce::String label;
+    juce::Value threshold;
+    
+    HistView view;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+    FrameProfiler& profiler;
+    int profilerView;
+};
@@ -1,24 +1,24 @@
-/*
-  ==============================================================================
-
-    HistogramEnums.h
-    Created: 2 Apr 2022 12:50:24am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-//==============================================================================
-enum class HistogramTypes
-{
-    RMS,
-    PEAK
-};
-
-enum HistView
-{
-    rows = 1,
-    columns
-};
+/*
+  ==============================================================================
+
+    HistogramEnums.h
+    Created: 2 Apr 2022 12:50:24am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//==============================================================================
+enum class HistogramTypes
+{
+    RMS,
+    PEAK
+};
+
+enum HistView
+{
+    rows = 1,
+    columns
+};
@@ -0,0 +1,182 @@
+/*
+  ==============================================================================
+
+    LevelPyramid.cpp
+    Created: 19 Oct 2026 1:48:15am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "LevelPyramid.h"
+#include <algorithm>
+
+//==============================================================================
+LevelPyramid::LevelPyramid()
+    : buckets(static_cast<size_t>(numLevels) * bucketsPerLevel)
+{
+}
+
+juce::uint64 LevelPyramid::getBucketLength(const int& level)
+{
+    juce::uint64 length = 1;
+    
+    for ( auto l = 0; l < level; ++l )
+        length *= fanOut;
+    
+    return length;
+}
+
+const LevelPyramid::Bucket& LevelPyramid::getBucket(const int& level, const juce::uint64& index) const
+{
+    return buckets[static_cast<size_t>(level) * bucketsPerLevel + index % bucketsPerLevel];
+}
+
+LevelPyramid::Bucket& LevelPyramid::getBucket(const int& level, const juce::uint64& index)
+{
+    return buckets[static_cast<size_t>(level) * bucketsPerLevel + index % bucketsPerLevel];
+}
+
+juce::uint64 LevelPyramid::getOldestHeld(const int& level) const
+{
+    auto numComplete = numPushed / getBucketLength(level);
+    auto oldestBucket = numComplete > bucketsPerLevel ? numComplete - bucketsPerLevel : 0;
+    
+    return oldestBucket * getBucketLength(level);
+}
+
+//==============================================================================
+void LevelPyramid::push(const float& value)
+{
+    const juce::ScopedLock sl(lock);
+    pushHeld(value);
+}
+
+void LevelPyramid::pushGap(const juce::uint64& numValues)
+{
+    const juce::ScopedLock sl(lock);
+    
+    // a gap this long leaves nothing from before it in any level
+    if ( numValues >= getMaxSpan() )
+    {
+        std::fill(buckets.begin(), buckets.end(), Bucket { Globals::negInf(), Globals::negInf(), Globals::negInf() });
+        numPushed += numValues;
+        return;
+    }
+    
+    for ( juce::uint64 i = 0; i < numValues; ++i )
+        pushHeld(Globals::negInf());
+}
+
+juce::uint64 LevelPyramid::getNumPushed() const
+{
+    const juce::ScopedLock sl(lock);
+    return numPushed;
+}
+
+void LevelPyramid::pushHeld(const float& value)
+{
+    getBucket(0, numPushed) = { value, value, value };
+    ++numPushed;
+    
+    // every level whose newest bucket this value completes gets it, from the
+    // fanOut buckets below, which are always still there
+    for ( auto level = 1; level < numLevels; ++level )
+    {
+        auto length = getBucketLength(level);
+        
+        if ( numPushed % length != 0 )
+            break;
+        
+        auto firstBelow = (numPushed - length) / getBucketLength(level - 1);
+        Bucket combined = getBucket(level - 1, firstBelow);
+        auto sum = combined.mean;
+        
+        for ( auto k = 1; k < fanOut; ++k )
+        {
+            auto& below = getBucket(level - 1, firstBelow + static_cast<juce::uint64>(k));
+            combined.min = juce::jmin(combined.min, below.min);
+            combined.max = juce::jmax(combined.max, below.max);
+            sum += below.mean;
+        }
+        
+        combined.mean = sum / static_cast<float>(fanOut);
+        getBucket(level, numPushed / length - 1) = combined;
+    }
+}
+
+//==============================================================================
+LevelPyramid::Bucket LevelPyramid::get(const juce::int64& start, const juce::int64& end) const
+{
+    const juce::ScopedLock sl(lock);
+    return getHeld(start, end);
+}
+
+LevelPyramid::Bucket LevelPyramid::getHeld(const juce::int64& start, const juce::int64& end) const
+{
+    const Bucket empty { Globals::negInf(), Globals::negInf(), Globals::negInf() };
+    auto oldest = static_cast<juce::int64>(getOldestHeld(numLevels - 1));
+    auto newest = static_cast<juce::int64>(numPushed);
+    
+    auto from = juce::jmax(start, oldest);
+    auto to = juce::jmin(end, newest);
+    
+    if ( from >= to )
+        return empty;
+    
+    Bucket result { Globals::maxDb(), Globals::negInf(), 0.f };
+    auto sum = 0.0;
+    auto position = static_cast<juce::uint64>(from);
+    auto stop = static_cast<juce::uint64>(to);
+    
+    // the fewest buckets that tile the stretch: at each step the coarsest one
+    // that starts there and doesn't run past the end, so a column costs a few
+    // buckets per level whatever its length
+    while ( position < stop )
+    {
+        auto level = 0;
+        
+        while ( level < numLevels - 1 )
+        {
+            auto length = getBucketLength(level + 1);
+            
+            if ( position % length != 0 || position + length > stop )
+                break;
+            
+            ++level;
+        }
+        
+        // history this old is only held coarser, so take the whole bucket around it
+        while ( level < numLevels - 1 && getOldestHeld(level) > position )
+            ++level;
+        
+        auto length = getBucketLength(level);
+        auto index = position / length;
+        auto& bucket = getBucket(level, index);
+        auto bucketEnd = (index + 1) * length;
+        
+        result.min = juce::jmin(result.min, bucket.min);
+        result.max = juce::jmax(result.max, bucket.max);
+        sum += static_cast<double>(bucket.mean) * static_cast<double>(juce::jmin(bucketEnd, stop) - position);
+        
+        position = bucketEnd;
+    }
+    
+    result.mean = static_cast<float>(sum / static_cast<double>(to - from));
+    
+    return result;
+}
+
+void LevelPyramid::read(Bucket* destination, const int& numColumns, const juce::uint64& valuesPerColumn) const
+{
+    const juce::ScopedLock sl(lock);
+    
+    auto newest = static_cast<juce::int64>(numPushed);
+    auto length = static_cast<juce::int64>(juce::jmax<juce::uint64>(1, valuesPerColumn));
+    
+    for ( auto column = 0; column < numColumns; ++column )
+    {
+        auto end = newest - static_cast<juce::int64>(numColumns - 1 - column) * length;
+        destination[column] = getHeld(end - length, end);
+    }
+}
@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    LevelPyramid.h
+    Created: 19 Oct 2026 1:48:15am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "Globals.h"
+
+//==============================================================================
+/*
+Level history at several resolutions, so a histogram can show the last few
+seconds frame by frame or most of a day at once, for the same cost per column.
+Level 0 keeps every value pushed, one per analysis frame (25ms at 40 frames a
+second). Each level above keeps the min, max and mean of fanOut buckets of the
+one below, up to 25.6s a bucket at the top. Every level holds the same number
+of buckets, so memory is fixed and older history is kept only at coarser
+resolution: ~100s frame by frame, ~29 hours at the top.
+Written by AnalysisState's follower thread and read by the histograms on the
+message thread, each under the pyramid's own lock. A whole read() is done
+with it held, so a paint sees every column as of the same moment.
+*/
+struct LevelPyramid
+{
+    static constexpr int numLevels = 6;
+    static constexpr int fanOut = 4;
+    static constexpr juce::uint64 bucketsPerLevel = 4096;
+    
+    struct Bucket
+    {
+        float min, max, mean;
+    };
+    
+    LevelPyramid();
+    
+    void push(const float& value);
+    
+    // numValues of Globals::negInf(), for time nothing was measured in, so the
+    // history either side stays where it was in time
+    void pushGap(const juce::uint64& numValues);
+    
+    juce::uint64 getNumPushed() const;
+    
+    // values one bucket covers at a level
+    static juce::uint64 getBucketLength(const int& level);
+    
+    // the longest stretch that can be shown, in values
+    static juce::uint64 getMaxSpan() { return getBucketLength(numLevels - 1) * bucketsPerLevel; }
+    
+    // the values from start to end, exact wherever the finer levels still hold
+    // them; anything already gone reads as Globals::negInf()
+    Bucket get(const juce::int64& start, const juce::int64& end) const;
+    
+    // numColumns stretches of valuesPerColumn each, oldest first, the last one
+    // ending with the newest value
+    void read(Bucket* destination, const int& numColumns, const juce::uint64& valuesPerColumn) const;
+
+private:
+    // with the lock held
+    void pushHeld(const float& value);
+    Bucket getHeld(const juce::int64& start, const juce::int64& end) const;
+    
+    juce::uint64 getOldestHeld(const int& level) const;
+    const Bucket& getBucket(const int& level, const juce::uint64& index) const;
+    Bucket& getBucket(const int& level, const juce::uint64& index);
+    
+    // numLevels rings of bucketsPerLevel, allocated once
+    std::vector<Bucket> buckets;
+    juce::uint64 numPushed = 0;
+    
+    juce::CriticalSection lock;
+};
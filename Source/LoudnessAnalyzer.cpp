@@ -0,0 +1,351 @@
+/*
+  ==============================================================================
+
+    LoudnessAnalyzer.cpp
+    Created: 18 Oct 2026 11:06:38pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "LoudnessAnalyzer.h"
+
+//==============================================================================
+std::array<LoudnessAnalyzer::Biquad, 2> LoudnessAnalyzer::designKWeighting(const double& sampleRate)
+{
+    // analogue prototypes fitted to the 48kHz coefficients in BS.1770, so the
+    // response is the same at every other rate
+    std::array<Biquad, 2> stages;
+    
+    {
+        const auto f0 = 1681.974450955533;
+        const auto gainDb = 3.999843853973347;
+        const auto q = 0.7071752369554196;
+        
+        auto k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        auto vh = std::pow(10.0, gainDb / 20.0);
+        auto vb = std::pow(vh, 0.4996667741545416);
+        auto a0 = 1.0 + k / q + k * k;
+        
+        auto& shelf = stages[0];
+        shelf.b0 = (vh + vb * k / q + k * k) / a0;
+        shelf.b1 = 2.0 * (k * k - vh) / a0;
+        shelf.b2 = (vh - vb * k / q + k * k) / a0;
+        shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+        shelf.a2 = (1.0 - k / q + k * k) / a0;
+    }
+    
+    {
+        const auto f0 = 38.13547087602444;
+        const auto q = 0.5003270373238773;
+        
+        auto k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        auto a0 = 1.0 + k / q + k * k;
+        
+        auto& highPass = stages[1];
+        highPass.b0 = 1.0;
+        highPass.b1 = -2.0;
+        highPass.b2 = 1.0;
+        highPass.a1 = 2.0 * (k * k - 1.0) / a0;
+        highPass.a2 = (1.0 - k / q + k * k) / a0;
+    }
+    
+    return stages;
+}
+
+std::array<float, Globals::maxChannels> LoudnessAnalyzer::getChannelWeights(const juce::AudioChannelSet& layout)
+{
+    std::array<float, Globals::maxChannels> channelWeights;
+    channelWeights.fill(1.f);
+    
+    // Ls and Rs are at 110 degrees in 5.1, but are the rears when there are
+    // sides as well (a 7.1 WAV channel mask, for one); heights are all above 30
+    // degrees so keep a weight of 1
+    auto hasSides = layout.getChannelIndexForType(juce::AudioChannelSet::leftSurroundSide) >= 0
+                 || layout.getChannelIndexForType(juce::AudioChannelSet::rightSurroundSide) >= 0;
+    
+    for ( auto ch = 0; ch < juce::jmin(layout.size(), Globals::maxChannels); ++ch )
+    {
+        switch (layout.getTypeOfChannel(ch))
+        {
+            case juce::AudioChannelSet::LFE:
+            case juce::AudioChannelSet::LFE2:
+                channelWeights[ch] = 0.f;
+                break;
+            case juce::AudioChannelSet::leftSurroundSide:
+            case juce::AudioChannelSet::rightSurroundSide:
+                channelWeights[ch] = 1.41f;
+                break;
+            case juce::AudioChannelSet::leftSurround:
+            case juce::AudioChannelSet::rightSurround:
+                channelWeights[ch] = hasSides ? 1.f : 1.41f;
+                break;
+            default:
+                break;
+        }
+    }
+    
+    return channelWeights;
+}
+
+float LoudnessAnalyzer::toLufs(const double& energy)
+{
+    if ( energy <= 0.0 )
+        return minLufs;
+    
+    return juce::jmax(minLufs, static_cast<float>(-0.691 + 10.0 * std::log10(energy)));
+}
+
+//==============================================================================
+void LoudnessAnalyzer::GatingHistogram::clear()
+{
+    counts.fill(0);
+    energies.fill(0.0);
+}
+
+void LoudnessAnalyzer::GatingHistogram::add(const double& energy)
+{
+    // the absolute gate
+    if ( energy <= 0.0 )
+        return;
+    
+    auto lufs = -0.691 + 10.0 * std::log10(energy);
+    
+    if ( lufs < minLufs )
+        return;
+    
+    auto bin = juce::jmin(numBins - 1, static_cast<int>((lufs - minLufs) * binsPerLu));
+    
+    ++counts[bin];
+    energies[bin] += energy;
+}
+
+void LoudnessAnalyzer::GatingHistogram::merge(const GatingHistogram& other)
+{
+    for ( auto bin = 0; bin < numBins; ++bin )
+    {
+        counts[bin] += other.counts[bin];
+        energies[bin] += other.energies[bin];
+    }
+}
+
+juce::uint64 LoudnessAnalyzer::GatingHistogram::getNumBlocks() const
+{
+    juce::uint64 total = 0;
+    
+    for ( auto count : counts )
+        total += count;
+    
+    return total;
+}
+
+namespace
+{
+
+int getFirstBin(const float& gateLufs)
+{
+    auto bin = static_cast<int>(std::floor((gateLufs - LoudnessAnalyzer::minLufs) * LoudnessAnalyzer::GatingHistogram::binsPerLu));
+    
+    return juce::jlimit(0, LoudnessAnalyzer::GatingHistogram::numBins - 1, bin);
+}
+
+}
+
+double LoudnessAnalyzer::GatingHistogram::getMeanEnergy(const float& gateLufs) const
+{
+    juce::uint64 numBlocks = 0;
+    double sum = 0.0;
+    
+    for ( auto bin = getFirstBin(gateLufs); bin < numBins; ++bin )
+    {
+        numBlocks += counts[bin];
+        sum += energies[bin];
+    }
+    
+    return numBlocks > 0 ? sum / static_cast<double>(numBlocks) : 0.0;
+}
+
+float LoudnessAnalyzer::GatingHistogram::getPercentile(const float& gateLufs, const double& fraction) const
+{
+    auto firstBin = getFirstBin(gateLufs);
+    juce::uint64 numBlocks = 0;
+    
+    for ( auto bin = firstBin; bin < numBins; ++bin )
+        numBlocks += counts[bin];
+    
+    if ( numBlocks == 0 )
+        return minLufs;
+    
+    // the same rounding as the EBU Tech 3342 reference, which sorts the blocks
+    auto index = static_cast<juce::uint64>(static_cast<double>(numBlocks - 1) * fraction + 0.5);
+    juce::uint64 seen = 0;
+    
+    for ( auto bin = firstBin; bin < numBins; ++bin )
+    {
+        seen += counts[bin];
+        
+        // the mean of the bin is closer than its centre when all the blocks are alike
+        if ( seen > index )
+            return toLufs(energies[bin] / static_cast<double>(counts[bin]));
+    }
+    
+    return minLufs;
+}
+
+//==============================================================================
+void LoudnessAnalyzer::prepare(const double& sampleRate, const int& numChannels, const std::array<float, Globals::maxChannels>& channelWeights)
+{
+    kWeighting = designKWeighting(sampleRate);
+    weights = channelWeights;
+    numPreparedChannels = juce::jlimit(0, Globals::maxChannels, numChannels);
+    stepLength = getStepLength(sampleRate);
+    
+    reset();
+}
+
+void LoudnessAnalyzer::prepare(const double& sampleRate, const juce::AudioChannelSet& layout)
+{
+    prepare(sampleRate, layout.size(), getChannelWeights(layout));
+}
+
+void LoudnessAnalyzer::reset()
+{
+    for ( auto& channelState : state )
+        channelState.fill(0.0);
+    
+    sumOfSquares.fill(0.0);
+    samplesInStep = 0;
+    
+    steps.fill(0.0);
+    numSteps = 0;
+    
+    momentaryEnergy = 0.0;
+    shortTermEnergy = 0.0;
+    
+    clearMeasurements();
+}
+
+void LoudnessAnalyzer::clearMeasurements()
+{
+    maxMomentaryEnergy = 0.0;
+    maxShortTermEnergy = 0.0;
+    
+    integratedBlocks.clear();
+    rangeBlocks.clear();
+}
+
+int LoudnessAnalyzer::getStepLength(const double& sampleRate)
+{
+    return juce::jmax(1, juce::roundToInt(sampleRate * 0.1));
+}
+
+void LoudnessAnalyzer::process(const float* const* channels, const int& numChannels, const int& numSamples)
+{
+    juce::ScopedNoDenormals noDenormals;
+    
+    const auto channelsToProcess = juce::jmin(numChannels, numPreparedChannels);
+    const auto& shelf = kWeighting[0];
+    const auto& highPass = kWeighting[1];
+    
+    auto start = 0;
+    
+    while ( start < numSamples )
+    {
+        auto count = juce::jmin(numSamples - start, stepLength - samplesInStep);
+        
+        for ( auto ch = 0; ch < channelsToProcess; ++ch )
+        {
+            auto* samples = channels[ch] + start;
+            auto& s = state[ch];
+            auto sum = 0.0;
+            
+            for ( auto i = 0; i < count; ++i )
+            {
+                // a single NaN or inf would stay in the filter state for good
+                auto x = std::isfinite(samples[i]) ? static_cast<double>(samples[i]) : 0.0;
+                
+                auto y = shelf.b0 * x + s[0];
+                s[0] = shelf.b1 * x - shelf.a1 * y + s[1];
+                s[1] = shelf.b2 * x - shelf.a2 * y;
+                
+                auto z = highPass.b0 * y + s[2];
+                s[2] = highPass.b1 * y - highPass.a1 * z + s[3];
+                s[3] = highPass.b2 * y - highPass.a2 * z;
+                
+                sum += z * z;
+            }
+            
+            sumOfSquares[ch] += sum;
+        }
+        
+        samplesInStep += count;
+        start += count;
+        
+        if ( samplesInStep == stepLength )
+            finishStep();
+    }
+}
+
+void LoudnessAnalyzer::finishStep()
+{
+    auto energy = 0.0;
+    
+    for ( auto ch = 0; ch < numPreparedChannels; ++ch )
+    {
+        energy += weights[ch] * sumOfSquares[ch];
+        sumOfSquares[ch] = 0.0;
+    }
+    
+    steps[numSteps % shortTermSteps] = energy / stepLength;
+    ++numSteps;
+    samplesInStep = 0;
+    
+    auto meanOfLast = [this](const int& n)
+    {
+        auto sum = 0.0;
+        
+        for ( auto k = 0; k < n; ++k )
+            sum += steps[(numSteps - 1 - k) % shortTermSteps];
+        
+        return sum / n;
+    };
+    
+    // 400ms blocks overlapping by 75% are the gating blocks for integrated loudness
+    if ( numSteps >= momentarySteps )
+    {
+        momentaryEnergy = meanOfLast(momentarySteps);
+        maxMomentaryEnergy = juce::jmax(maxMomentaryEnergy, momentaryEnergy);
+        integratedBlocks.add(momentaryEnergy);
+    }
+    
+    // and 3s blocks every 100ms for the loudness range
+    if ( numSteps >= shortTermSteps )
+    {
+        shortTermEnergy = meanOfLast(shortTermSteps);
+        maxShortTermEnergy = juce::jmax(maxShortTermEnergy, shortTermEnergy);
+        rangeBlocks.add(shortTermEnergy);
+    }
+}
+
+//==============================================================================
+float LoudnessAnalyzer::getIntegratedLufs(const GatingHistogram& momentaryBlocks)
+{
+    auto absoluteGated = momentaryBlocks.getMeanEnergy(minLufs);
+    
+    if ( absoluteGated <= 0.0 )
+        return minLufs;
+    
+    return toLufs(momentaryBlocks.getMeanEnergy(toLufs(absoluteGated) - 10.f));
+}
+
+float LoudnessAnalyzer::getLoudnessRange(const GatingHistogram& shortTermBlocks)
+{
+    auto absoluteGated = shortTermBlocks.getMeanEnergy(minLufs);
+    
+    if ( absoluteGated <= 0.0 )
+        return 0.f;
+    
+    auto relativeGate = toLufs(absoluteGated) - 20.f;
+    
+    return shortTermBlocks.getPercentile(relativeGate, 0.95) - shortTermBlocks.getPercentile(relativeGate, 0.10);
+}
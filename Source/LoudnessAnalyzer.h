@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    LoudnessAnalyzer.h
+    Created: 18 Oct 2026 11:06:38pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "Globals.h"
+
+//==============================================================================
+/*
+ITU-R BS.1770-4 loudness with the EBU R 128 measures: momentary (400ms),
+short-term (3s), integrated and loudness range (EBU Tech 3342).
+Each channel is K-weighted and its energy summed per 100ms step; momentary
+and short-term are the mean of the last 4 and 30 steps. Gating blocks go
+into histograms of energy rather than a list, so memory doesn't grow with
+programme length, and measurements of different parts of a programme can be
+merged by adding their histograms.
+Everything is allocated up front, so process() is safe on the audio thread.
+*/
+struct LoudnessAnalyzer
+{
+    // silence, and anything below the absolute gate, reads as this
+    static constexpr float minLufs = -70.f;
+    
+    // transposed direct form II, a0 normalised to 1
+    struct Biquad
+    {
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+    };
+    
+    // the BS.1770 pre-filter (high shelf) and RLB high-pass, for any sample rate
+    static std::array<Biquad, 2> designKWeighting(const double& sampleRate);
+    
+    // BS.1770 channel weights by what each channel of the layout is: 0 for the
+    // LFEs, 1.41 for surrounds between 60 and 120 degrees, 1 for the rest
+    // (including any channels past the end of the layout)
+    static std::array<float, Globals::maxChannels> getChannelWeights(const juce::AudioChannelSet& layout);
+    
+    /*
+    Gating blocks by loudness, 0.1 LU per bin from the absolute gate up. Each bin
+    keeps how many blocks landed in it and the sum of their energies, so means
+    above a gate are exact apart from the bin the gate falls in.
+    */
+    struct GatingHistogram
+    {
+        static constexpr int binsPerLu = 10;
+        static constexpr int numBins = 100 * binsPerLu; // -70 to +30 LUFS
+        
+        void clear();
+        void add(const double& energy);
+        void merge(const GatingHistogram& other);
+        
+        juce::uint64 getNumBlocks() const;
+        
+        // mean energy of the blocks at or above gateLufs, 0 if there are none
+        double getMeanEnergy(const float& gateLufs) const;
+        
+        // the loudness below which fraction of the blocks at or above gateLufs fall
+        float getPercentile(const float& gateLufs, const double& fraction) const;
+        
+        std::array<juce::uint64, numBins> counts {};
+        std::array<double, numBins> energies {};
+    };
+    
+    void prepare(const double& sampleRate, const int& numChannels, const std::array<float, Globals::maxChannels>& channelWeights);
+    void prepare(const double& sampleRate, const juce::AudioChannelSet& layout);
+    void reset();
+    
+    // forgets the gating blocks and maxima so far but keeps the filter and window
+    // state, so that after a few seconds of pre-roll measuring can start part way
+    // into a programme and read exactly as it would have from the beginning
+    void clearMeasurements();
+    
+    // momentary and short-term move on, and gating blocks are taken, every this many samples
+    static int getStepLength(const double& sampleRate);
+    static constexpr int shortTermSteps = 30;
+    
+    // channels beyond those prepared for are ignored
+    void process(const float* const* channels, const int& numChannels, const int& numSamples);
+    
+    float getMomentaryLufs() const { return toLufs(momentaryEnergy); }
+    float getShortTermLufs() const { return toLufs(shortTermEnergy); }
+    float getMaxMomentaryLufs() const { return toLufs(maxMomentaryEnergy); }
+    float getMaxShortTermLufs() const { return toLufs(maxShortTermEnergy); }
+    
+    // over everything since prepare() or reset()
+    float getIntegratedLufs() const { return getIntegratedLufs(integratedBlocks); }
+    float getLoudnessRange() const { return getLoudnessRange(rangeBlocks); }
+    
+    // the same, from histograms merged from several measurements
+    static float getIntegratedLufs(const GatingHistogram& momentaryBlocks);
+    static float getLoudnessRange(const GatingHistogram& shortTermBlocks);
+    
+    const GatingHistogram& getIntegratedBlocks() const { return integratedBlocks; }
+    const GatingHistogram& getRangeBlocks() const { return rangeBlocks; }
+    
+    static float toLufs(const double& energy);
+
+private:
+    void finishStep();
+    
+    static constexpr int momentarySteps = 4;
+    
+    std::array<Biquad, 2> kWeighting;
+    std::array<float, Globals::maxChannels> weights {};
+    int numPreparedChannels = 0;
+    
+    // filter state per channel, two per stage
+    std::array<std::array<double, 4>, Globals::maxChannels> state {};
+    
+    int stepLength = 4800;
+    int samplesInStep = 0;
+    std::array<double, Globals::maxChannels> sumOfSquares {};
+    
+    // weighted mean square of the most recent steps
+    std::array<double, shortTermSteps> steps {};
+    juce::uint64 numSteps = 0;
+    
+    double momentaryEnergy = 0.0;
+    double shortTermEnergy = 0.0;
+    double maxMomentaryEnergy = 0.0;
+    double maxShortTermEnergy = 0.0;
+    
+    GatingHistogram integratedBlocks;
+    GatingHistogram rangeBlocks;
+};
@@ -0,0 +1,113 @@
+/*
+  ==============================================================================
+
+    MeterAnalyzer.cpp
+    Created: 18 Oct 2026 1:48:31pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "MeterAnalyzer.h"
+
+//==============================================================================
+void MeterAnalyzer::setNumChannels(const int& newNumChannels)
+{
+    numChannels[Main] = juce::jlimit(1, Globals::maxChannels, newNumChannels);
+    
+    rmsDb.fill(Globals::negInf());
+    peakDb.fill(Globals::negInf());
+    
+    rms.setNumChannels(numChannels[Main]);
+    peak.setNumChannels(numChannels[Main]);
+}
+
+void MeterAnalyzer::process(const AnalysisFrame& frame, const juce::int64& nowMs)
+{
+    rmsDb = frame.rmsDb;
+    peakDb = frame.peakDb;
+    
+    // channels the audio thread didn't measure stay silent
+    for ( auto ch = frame.numChannels[Main]; ch < numChannels[Main]; ++ch )
+    {
+        rmsDb[ch] = Globals::negInf();
+        peakDb[ch] = Globals::negInf();
+    }
+    
+    rms.update(rmsDb.data(), nowMs);
+    peak.update(peakDb.data(), nowMs);
+    
+    auto numReferenceChannels = frame.numChannels[Reference];
+    
+    if ( numReferenceChannels != numChannels[Reference] && numReferenceChannels > 0 )
+    {
+        referenceRms.setNumChannels(numReferenceChannels);
+        referencePeak.setNumChannels(numReferenceChannels);
+    }
+    
+    numChannels[Reference] = numReferenceChannels;
+    
+    if ( hasReference() )
+    {
+        auto firstLane = AnalysisFrame::getLane(Reference, 0);
+        referenceRms.update(rmsDb.data() + firstLane, nowMs);
+        referencePeak.update(peakDb.data() + firstLane, nowMs);
+    }
+}
+
+void MeterAnalyzer::advance(const juce::int64& nowMs)
+{
+    for ( auto* ballistics : getAllBallistics() )
+        ballistics->advance(nowMs);
+}
+
+void MeterAnalyzer::setRmsThreshold(const float& threshAsDecibels)
+{
+    rms.setThreshold(threshAsDecibels);
+    referenceRms.setThreshold(threshAsDecibels);
+}
+
+void MeterAnalyzer::setPeakThreshold(const float& threshAsDecibels)
+{
+    peak.setThreshold(threshAsDecibels);
+    referencePeak.setThreshold(threshAsDecibels);
+}
+
+void MeterAnalyzer::setDecayRate(const int& selectedId)
+{
+    for ( auto* ballistics : getAllBallistics() )
+        ballistics->setDecayRate(selectedId);
+}
+
+void MeterAnalyzer::setTickHoldTime(const int& selectedId)
+{
+    for ( auto* ballistics : getAllBallistics() )
+        ballistics->setTickHoldTime(selectedId);
+}
+
+void MeterAnalyzer::resizeAverager(const int& durationId)
+{
+    for ( auto* ballistics : getAllBallistics() )
+        ballistics->resizeAverager(durationId);
+}
+
+void MeterAnalyzer::resetTicks()
+{
+    for ( auto* ballistics : getAllBallistics() )
+        ballistics->resetTicks();
+}
+
+float MeterAnalyzer::getMean(const Lanes& lanes, const Stream& stream) const
+{
+    auto count = numChannels[stream];
+    if ( count == 0 )
+        return Globals::negInf();
+    
+    auto firstLane = AnalysisFrame::getLane(stream, 0);
+    auto sum = 0.f;
+    
+    for ( auto ch = 0; ch < count; ++ch )
+        sum += lanes[firstLane + ch];
+    
+    return sum / count;
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+
+    MeterAnalyzer.h
+    Created: 18 Oct 2026 1:48:31pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "Globals.h"
+#include "MeterBallistics.h"
+#include "AnalysisFrame.h"
+
+//==============================================================================
+/*
+Channel count agnostic level metering.
+Takes the levels measured on the audio thread and feeds them to the
+ballistics of both meter types, for the main bus and for the sidechain
+reference.
+*/
+struct MeterAnalyzer
+{
+    void setNumChannels(const int& newNumChannels);
+    int getNumChannels() const { return numChannels[Main]; }
+    bool hasReference() const { return numChannels[Reference] > 0; }
+    
+    void process(const AnalysisFrame& frame, const juce::int64& nowMs);
+    void advance(const juce::int64& nowMs);
+    
+    // applied to main and reference alike, so the two stay comparable
+    void setRmsThreshold(const float& threshAsDecibels);
+    void setPeakThreshold(const float& threshAsDecibels);
+    void setDecayRate(const int& selectedId);
+    void setTickHoldTime(const int& selectedId);
+    void resizeAverager(const int& durationId);
+    void resetTicks();
+    
+    // mean across channels, in decibels
+    float getMeanRmsDb(const Stream& stream) const { return getMean(rmsDb, stream); }
+    float getMeanPeakDb(const Stream& stream) const { return getMean(peakDb, stream); }
+    
+    MeterBallistics rms;
+    MeterBallistics peak;
+    
+    MeterBallistics referenceRms;
+    MeterBallistics referencePeak;
+    
+private:
+    using Lanes = std::array<float, AnalysisFrame::maxLanes>;
+    
+    float getMean(const Lanes& lanes, const Stream& stream) const;
+    
+    std::array<MeterBallistics*, 4> getAllBallistics() { return { &rms, &peak, &referenceRms, &referencePeak }; }
+    
+    std::array<int, NumStreams> numChannels { 2, 0 };
+    
+    alignas(16) Lanes rmsDb;
+    alignas(16) Lanes peakDb;
+};
@@ -0,0 +1,206 @@
+/*
+  ==============================================================================
+
+    MeterBallistics.cpp
+    Created: 18 Oct 2026 1:20:04pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "MeterBallistics.h"
+
+//==============================================================================
+MeterBallistics::MeterBallistics()
+{
+    level.fill(Globals::negInf());
+    heldValue.fill(Globals::negInf());
+    heldTime.fill(juce::Time::currentTimeMillis());
+    
+    instantTick.reset();
+    averageTick.reset();
+    
+    fillAverager(Globals::negInf());
+}
+
+void MeterBallistics::setNumChannels(const int& newNumChannels)
+{
+    jassert(newNumChannels > 0 && newNumChannels <= Globals::maxChannels);
+    numChannels = juce::jlimit(1, Globals::maxChannels, newNumChannels);
+}
+
+void MeterBallistics::setThreshold(const float& threshAsDecibels)
+{
+    threshold = threshAsDecibels;
+}
+
+void MeterBallistics::setDecayRate(const int& selectedId)
+{
+    float dbPerSecond;
+    
+    switch (selectedId)
+    {
+        case 1:  dbPerSecond = 3.f;  break;
+        case 2:  dbPerSecond = 6.f;  break;
+        case 3:  dbPerSecond = 12.f; break;
+        case 4:  dbPerSecond = 24.f; break;
+        case 5:  dbPerSecond = 36.f; break;
+        default: dbPerSecond = 12.f; break;
+    }
+    
+    decayRatePerFrame = dbPerSecond / frameRateHz;
+}
+
+void MeterBallistics::setTickHoldTime(const int& selectedId)
+{
+    switch (selectedId)
+    {
+        case 1:  tickHoldTime = 0;    break;
+        case 2:  tickHoldTime = 500;  break;
+        case 3:  tickHoldTime = 2000; break;
+        case 4:  tickHoldTime = 4000; break;
+        case 5:  tickHoldTime = 6000; break;
+        case 6:  tickHoldTime = std::numeric_limits<juce::int64>::max(); break; // inf
+        default: tickHoldTime = 500;  break;
+    }
+}
+
+void MeterBallistics::resizeAverager(const int& durationId)
+{
+    // one frame every 25ms
+    switch (durationId)
+    {
+        case 1:  averagerSize = 4;  break; // 100ms
+        case 2:  averagerSize = 10; break; // 250ms
+        case 3:  averagerSize = 20; break; // 500ms
+        case 4:  averagerSize = 40; break; // 1000ms
+        case 5:  averagerSize = 80; break; // 2000ms
+        default: averagerSize = 20; break; // 500ms
+    }
+    
+    jassert(averagerSize <= maxAveragerFrames);
+    
+    // restart every lane from its current average so the meters don't jump
+    for ( size_t frame = 0; frame < averagerSize; ++frame )
+        history[frame] = average;
+    
+    for ( auto ch = 0; ch < Globals::maxChannels; ++ch )
+        runningTotal[ch] = static_cast<double>(average[ch]) * averagerSize;
+    
+    historyIndex = 0;
+}
+
+void MeterBallistics::resetTicks()
+{
+    instantTick.reset();
+    averageTick.reset();
+}
+
+void MeterBallistics::update(const float* levels, const juce::int64& nowMs)
+{
+    using FVO = juce::FloatVectorOperations;
+    
+    FVO::copy(level.data(), levels, numChannels);
+    
+    // averaging: swap the oldest frame out of the running totals and the newest one in
+    auto& oldest = history[historyIndex];
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        runningTotal[ch] += static_cast<double>(levels[ch]) - oldest[ch];
+        average[ch] = static_cast<float>(runningTotal[ch] / averagerSize);
+    }
+    
+    FVO::copy(oldest.data(), levels, numChannels);
+    
+    historyIndex = (historyIndex + 1) % averagerSize;
+    
+    instantTick.capture(level.data(), numChannels, nowMs);
+    averageTick.capture(average.data(), numChannels, nowMs);
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        if ( level[ch] > threshold )
+        {
+            heldTime[ch] = nowMs;
+            heldValue[ch] = juce::jmax(heldValue[ch], level[ch]);
+        }
+    }
+}
+
+void MeterBallistics::advance(const juce::int64& nowMs)
+{
+    instantTick.decay(numChannels, nowMs, tickHoldTime, decayRatePerFrame);
+    averageTick.decay(numChannels, nowMs, tickHoldTime, decayRatePerFrame);
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        if ( nowMs - heldTime[ch] > textHoldTime )
+            heldValue[ch] = Globals::negInf();
+    }
+}
+
+float MeterBallistics::getInstantTick(const int& channel) const
+{
+    return tickHoldTime == 0 ? level[channel] : instantTick.value[channel];
+}
+
+float MeterBallistics::getAverageTick(const int& channel) const
+{
+    return tickHoldTime == 0 ? average[channel] : averageTick.value[channel];
+}
+
+float MeterBallistics::getTextValue(const int& channel) const
+{
+    return isOverThreshold(channel) ? heldValue[channel] : level[channel];
+}
+
+void MeterBallistics::fillAverager(const float& value)
+{
+    for ( auto& frame : history )
+        frame.fill(value);
+    
+    average.fill(value);
+    runningTotal.fill(static_cast<double>(value) * averagerSize);
+    historyIndex = 0;
+}
+
+//==============================================================================
+void MeterBallistics::DecayingHold::capture(const float* input, const int& numChannels, const juce::int64& nowMs)
+{
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        if ( input[ch] > value[ch] )
+        {
+            peakTime[ch] = nowMs;
+            value[ch] = input[ch];
+            multiplier[ch] = 1.f;
+        }
+    }
+}
+
+void MeterBallistics::DecayingHold::decay(const int& numChannels,
+                                          const juce::int64& nowMs,
+                                          const juce::int64& holdTimeMs,
+                                          const float& decayPerFrame)
+{
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        if ( nowMs - peakTime[ch] <= holdTimeMs )
+            continue;
+        
+        value[ch] = juce::jlimit(Globals::negInf(),
+                                 Globals::maxDb(),
+                                 value[ch] - (decayPerFrame * multiplier[ch]));
+        
+        // accelerate the fall until the floor is reached
+        multiplier[ch] = value[ch] == Globals::negInf() ? 1.f : multiplier[ch] * 1.04f;
+    }
+}
+
+void MeterBallistics::DecayingHold::reset()
+{
+    value.fill(Globals::negInf());
+    multiplier.fill(1.f);
+    peakTime.fill(juce::Time::currentTimeMillis());
+}
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    MeterBallistics.h
+    Created: 18 Oct 2026 1:20:04pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "Globals.h"
+
+//==============================================================================
+/*
+Averaging, falling tick and text hold state for every channel of one meter type.
+State is kept as structure-of-arrays (one array per quantity, one lane per
+channel) so each frame is a handful of passes over contiguous lanes instead of
+a set of objects and timers per channel.
+*/
+struct MeterBallistics
+{
+    MeterBallistics();
+    
+    void setNumChannels(const int& newNumChannels);
+    int getNumChannels() const { return numChannels; }
+    
+    void setThreshold(const float& threshAsDecibels);
+    void setDecayRate(const int& selectedId);
+    void setTickHoldTime(const int& selectedId);
+    void resizeAverager(const int& durationId);
+    void resetTicks();
+    
+    // new level for every channel, in decibels
+    void update(const float* levels, const juce::int64& nowMs);
+    
+    // hold expiry and decay, called once per display frame
+    void advance(const juce::int64& nowMs);
+    
+    float getLevel(const int& channel) const { return level[channel]; }
+    float getAverage(const int& channel) const { return average[channel]; }
+    float getInstantTick(const int& channel) const;
+    float getAverageTick(const int& channel) const;
+    float getTextValue(const int& channel) const;
+    bool isOverThreshold(const int& channel) const { return level[channel] > threshold; }
+    
+    static constexpr int frameRateHz = 40;
+    static constexpr size_t maxAveragerFrames = 80; // 2000ms at frameRateHz
+
+private:
+    using Lanes = std::array<float, Globals::maxChannels>;
+    using TimeLanes = std::array<juce::int64, Globals::maxChannels>;
+    
+    // a falling tick per channel
+    struct DecayingHold
+    {
+        void capture(const float* input, const int& numChannels, const juce::int64& nowMs);
+        void decay(const int& numChannels, const juce::int64& nowMs, const juce::int64& holdTimeMs, const float& decayPerFrame);
+        void reset();
+        
+        alignas(16) Lanes value;
+        alignas(16) Lanes multiplier;
+        TimeLanes peakTime;
+    };
+    
+    int numChannels = 2;
+    float threshold = 0.f;
+    float decayRatePerFrame = 12.f / frameRateHz;
+    juce::int64 tickHoldTime = 500;
+    static constexpr juce::int64 textHoldTime = 2000;
+    
+    alignas(16) Lanes level;
+    
+    // averaging: history is frame major, so a frame for all channels is one contiguous row
+    std::array<Lanes, maxAveragerFrames> history;
+    size_t averagerSize = 20;
+    size_t historyIndex = 0;
+    
+    // double, so adding and removing dB values never leaves rounding behind:
+    // a window holding one value averages to exactly that value, however long it runs
+    alignas(16) std::array<double, Globals::maxChannels> runningTotal;
+    alignas(16) Lanes average;
+    
+    DecayingHold instantTick;
+    DecayingHold averageTick;
+    
+    // text readout: the highest value over threshold, held for textHoldTime
+    alignas(16) Lanes heldValue;
+    TimeLanes heldTime;
+    
+    void fillAverager(const float& value);
+};
@@ -0,0 +1,383 @@
+/*
+  ==============================================================================
+
+    OverCapture.cpp
+    Created: 19 Oct 2026 3:24:51am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "OverCapture.h"
+#include "MeterBallistics.h"
+
+//==============================================================================
+OverCapture::OverCapture(const AnalysisHistory& h)
+    : history(h)
+{
+}
+
+OverCapture::~OverCapture()
+{
+    const juce::ScopedLock sl(controlLock);
+    stopWriter();
+}
+
+juce::File OverCapture::getDirectory()
+{
+    return juce::File::getSpecialLocation(juce::File::userDocumentsDirectory).getChildFile("PFMProject10 Overs");
+}
+
+void OverCapture::prepare(const double& sampleRate, const int& numChannels)
+{
+    const juce::ScopedLock sl(controlLock);
+    auto wasCapturing = capturing.load(std::memory_order_relaxed);
+    
+    // the writer may be reading the ring
+    if ( wasCapturing )
+    {
+        stopWriter();
+        closeRing();
+    }
+    
+    preparedSampleRate = sampleRate;
+    preparedChannels = juce::jlimit(1, Globals::maxChannels, numChannels);
+    
+    numClaimed.store(0, std::memory_order_relaxed);
+    numWritten.store(0, std::memory_order_relaxed);
+    
+    if ( wasCapturing )
+    {
+        openRing();
+        startWriter();
+    }
+}
+
+void OverCapture::push(const juce::AudioBuffer<float>& main)
+{
+    auto numSamples = main.getNumSamples();
+    
+    if ( numSamples == 0 )
+        return;
+    
+    auto start = numWritten.load(std::memory_order_relaxed);
+    
+    pushing.store(true);
+    
+    if ( ringActive.load() )
+    {
+        auto generation = ringGeneration.load(std::memory_order_relaxed);
+        
+        if ( generation != pushedGeneration )
+        {
+            pushedGeneration = generation;
+            ringValidFrom.store(start, std::memory_order_relaxed);
+        }
+        
+        numClaimed.store(start + numSamples, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    
+        // a block longer than the ring only leaves its end behind
+        auto source = juce::jmax(0, numSamples - ringLength);
+        auto position = static_cast<int>((start + source) % ringLength);
+        auto numChannels = juce::jmin(main.getNumChannels(), ring.getNumChannels());
+    
+        while ( source < numSamples )
+        {
+            auto count = juce::jmin(numSamples - source, ringLength - position);
+        
+            for ( auto ch = 0; ch < ring.getNumChannels(); ++ch )
+            {
+                if ( ch < numChannels )
+                    ring.copyFrom(ch, position, main, ch, source, count);
+                else
+                    ring.clear(ch, position, count);
+            }
+        
+            source += count;
+            position = 0;
+        }
+    }
+    
+    pushing.store(false, std::memory_order_release);
+    numWritten.store(start + numSamples, std::memory_order_release);
+}
+
+void OverCapture::setCapturing(const bool& shouldCapture)
+{
+    const juce::ScopedLock sl(controlLock);
+    
+    if ( shouldCapture == capturing.load(std::memory_order_relaxed) )
+        return;
+    
+    if ( shouldCapture )
+    {
+        openRing();
+        startWriter();
+    }
+    else
+    {
+        stopWriter();
+        closeRing();
+    }
+    
+    capturing.store(shouldCapture, std::memory_order_relaxed);
+}
+
+void OverCapture::openRing()
+{
+    ringLength = juce::roundToInt(preparedSampleRate * ringSeconds);
+    ring.setSize(preparedChannels, ringLength);
+    ring.clear();
+    
+    ringValidFrom.store(std::numeric_limits<juce::int64>::max(), std::memory_order_relaxed);
+    ringGeneration.fetch_add(1, std::memory_order_relaxed);
+    
+    // publishes the ring to the audio thread
+    ringActive.store(true);
+}
+
+void OverCapture::closeRing()
+{
+    ringActive.store(false);
+    
+    // the audio thread may be part way through copying a block in
+    while ( pushing.load() )
+        juce::Thread::yield();
+    
+    ring = juce::AudioBuffer<float>();
+    ringLength = 0;
+    scratch = juce::AudioBuffer<float>();
+}
+
+void OverCapture::startWriter()
+{
+    // overs from before capturing was turned on aren't wanted
+    nextFrame = history.getNumWritten();
+    hasPending = false;
+    lastFrameWasOver = false;
+    
+    writer.startThread();
+}
+
+void OverCapture::stopWriter()
+{
+    // a capture still waiting for its post roll is dropped
+    writer.signalThreadShouldExit();
+    writer.notify();
+    writer.stopThread(2000);
+}
+
+//==============================================================================
+void OverCapture::Writer::run()
+{
+    while ( !threadShouldExit() )
+    {
+        capture.scanFrames();
+        wait(100);
+    }
+}
+
+void OverCapture::scanFrames()
+{
+    auto written = history.getNumWritten();
+    nextFrame = juce::jmax(nextFrame, history.getOldestAvailable());
+    
+    AnalysisFrame frame;
+    
+    for ( ; nextFrame < written; ++nextFrame )
+    {
+        if ( history.read(nextFrame, frame) )
+            noteFrame(frame);
+    }
+    
+    if ( hasPending && numWritten.load(std::memory_order_acquire) >= pending.windowEnd )
+    {
+        writeCapture(pending);
+        hasPending = false;
+    }
+}
+
+void OverCapture::noteFrame(const AnalysisFrame& frame)
+{
+    auto peak = Globals::negInf();
+    auto rms = Globals::negInf();
+    auto loudestChannel = 0;
+    
+    for ( auto ch = 0; ch < frame.numChannels[Main]; ++ch )
+    {
+        auto lane = AnalysisFrame::getLane(Main, ch);
+        
+        if ( frame.peakDb[lane] > peak )
+        {
+            peak = frame.peakDb[lane];
+            loudestChannel = ch;
+        }
+        
+        rms = juce::jmax(rms, frame.rmsDb[lane]);
+    }
+    
+    Capture over;
+    over.peakThreshold = peakThreshold.load(std::memory_order_relaxed);
+    over.rmsThreshold = rmsThreshold.load(std::memory_order_relaxed);
+    
+    // toDecibels reads a full scale sample as exactly 0dB
+    if ( peak >= 0.f )
+        over.flags |= Clip;
+    
+    if ( peak > over.peakThreshold )
+        over.flags |= PeakOver;
+    
+    if ( rms > over.rmsThreshold )
+        over.flags |= RmsOver;
+    
+    auto isNewEvent = over.flags != 0 && !lastFrameWasOver;
+    lastFrameWasOver = over.flags != 0;
+    
+    if ( over.flags == 0 )
+        return;
+    
+    // the same length FrameAnalyzer uses
+    auto frameLength = juce::jmax(1, juce::roundToInt(preparedSampleRate / MeterBallistics::frameRateHz));
+    auto frameStart = juce::jmax(juce::int64(0), frame.endSample - frameLength);
+    
+    // this over is past the end of the pending capture, which is therefore already in the ring
+    if ( hasPending && frameStart >= pending.windowEnd )
+    {
+        writeCapture(pending);
+        hasPending = false;
+    }
+    
+    if ( !hasPending )
+    {
+        if ( numCaptured.load(std::memory_order_relaxed) >= maxCaptures )
+            return;
+        
+        // no further back than the ring has been filling, if the audio thread has got to it yet
+        auto ringFrom = juce::jmin(ringValidFrom.load(std::memory_order_relaxed), frameStart);
+        over.windowStart = juce::jmax(ringFrom, frameStart - juce::roundToInt(preRollSeconds * preparedSampleRate));
+        over.windowEnd = frame.endSample + juce::roundToInt(postRollSeconds * preparedSampleRate);
+        over.firstEventSample = frameStart;
+        over.firstEventMs = frame.timeMs - juce::roundToInt(1000.0 * frameLength / preparedSampleRate);
+        over.peakDb = peak;
+        over.rmsDb = rms;
+        over.loudestChannel = loudestChannel;
+        over.numEvents = 1;
+        
+        pending = over;
+        hasPending = true;
+        return;
+    }
+    
+    pending.flags |= over.flags;
+    pending.numEvents += isNewEvent ? 1 : 0;
+    pending.rmsDb = juce::jmax(pending.rmsDb, rms);
+    
+    if ( peak > pending.peakDb )
+    {
+        pending.peakDb = peak;
+        pending.loudestChannel = loudestChannel;
+    }
+}
+
+bool OverCapture::copyFromRing(const juce::int64& start, const int& numSamples)
+{
+    auto written = numWritten.load(std::memory_order_acquire);
+    
+    if ( start + numSamples > written || start < written - ringLength
+         || start < ringValidFrom.load(std::memory_order_relaxed) )
+        return false;
+    
+    auto position = static_cast<int>(start % ringLength);
+    auto destination = 0;
+    
+    while ( destination < numSamples )
+    {
+        auto count = juce::jmin(numSamples - destination, ringLength - position);
+        
+        for ( auto ch = 0; ch < ring.getNumChannels(); ++ch )
+            scratch.copyFrom(ch, destination, ring, ch, position, count);
+        
+        destination += count;
+        position = 0;
+    }
+    
+    // if the audio thread came round to any of it while it was being copied, the copy is torn
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return start >= numClaimed.load(std::memory_order_relaxed) - ringLength;
+}
+
+void OverCapture::writeCapture(const Capture& c)
+{
+    auto numSamples = static_cast<int>(c.windowEnd - c.windowStart);
+    auto numChannels = ring.getNumChannels();
+    
+    // only the writer ever uses it, so it can grow here
+    scratch.setSize(numChannels, numSamples, false, false, true);
+    
+    // the writer fell more than the slack in the ring behind
+    if ( !copyFromRing(c.windowStart, numSamples) )
+        return;
+    
+    auto directory = getDirectory();
+    directory.createDirectory();
+    
+    auto file = directory.getNonexistentChildFile("over " + juce::Time(c.firstEventMs).formatted("%Y-%m-%d %H-%M-%S"), ".wav", false);
+    
+    // the bext time reference is the first sample, counted from midnight
+    auto startMs = c.firstEventMs - juce::roundToInt(1000.0 * (c.firstEventSample - c.windowStart) / preparedSampleRate);
+    auto startTime = juce::Time(startMs);
+    auto msSinceMidnight = (((startTime.getHours() * 60 + startTime.getMinutes()) * 60 + startTime.getSeconds()) * 1000)
+                           + startTime.getMilliseconds();
+    
+    juce::String kinds;
+    
+    if ( (c.flags & Clip) != 0 )
+        kinds << "clip ";
+    
+    if ( (c.flags & PeakOver) != 0 )
+        kinds << "peak ";
+    
+    if ( (c.flags & RmsOver) != 0 )
+        kinds << "rms ";
+    
+    // the bext description holds 256 characters
+    juce::String description;
+    description << "Overs: " << kinds.trimEnd()
+                << ". Peak " << juce::String(c.peakDb, 1) << " dBFS on channel " << (c.loudestChannel + 1)
+                << " (threshold " << juce::String(c.peakThreshold, 1) << ")"
+                << ", RMS " << juce::String(c.rmsDb, 1) << " dBFS (threshold " << juce::String(c.rmsThreshold, 1) << ")"
+                << ". " << c.numEvents << (c.numEvents == 1 ? " event" : " events")
+                << ", the first at " << juce::Time(c.firstEventMs).formatted("%H:%M:%S")
+                << ", " << juce::String((c.firstEventSample - c.windowStart) / preparedSampleRate, 2) << "s in.";
+    
+    auto metadata = juce::WavAudioFormat::createBWAVMetadata(description.substring(0, 256),
+                                                             "PFMProject10",
+                                                             file.getFileNameWithoutExtension(),
+                                                             startTime,
+                                                             static_cast<juce::int64>(msSinceMidnight * preparedSampleRate / 1000.0),
+                                                             {});
+    
+    auto stream = std::make_unique<juce::FileOutputStream>(file);
+    
+    if ( stream->failedToOpen() )
+        return;
+    
+    juce::WavAudioFormat format;
+    std::unique_ptr<juce::AudioFormatWriter> wavWriter (format.createWriterFor(stream.get(), preparedSampleRate,
+                                                                               static_cast<unsigned int>(numChannels),
+                                                                               24, metadata, 0));
+    
+    if ( wavWriter == nullptr )
+    {
+        stream.reset();
+        file.deleteFile();
+        return;
+    }
+    
+    // the writer owns the stream now
+    stream.release();
+    wavWriter->writeFromAudioSampleBuffer(scratch, 0, numSamples);
+    
+    numCaptured.fetch_add(1, std::memory_order_relaxed);
+}
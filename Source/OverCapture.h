@@ -0,0 +1,154 @@
+/*
+  ==============================================================================
+
+    OverCapture.h
+    Created: 19 Oct 2026 3:24:51am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <limits>
+#include "AnalysisHistory.h"
+
+//==============================================================================
+/*
+Saves the audio around overs, for tracking down the odd one in a long live
+recording after the fact.
+Nothing is allocated until capturing is turned on. From then on the audio
+thread copies the main bus into a ring holding the last few seconds and
+that's all it does: same cost every block, no locks. A background thread
+watches the analysis frames for a clip or a level over the RMS or peak
+threshold and, once the ring has moved past the end of the post roll, writes
+the pre and post roll around it to a Broadcast WAV, with the event described
+in its bext chunk. Overs that land inside a capture already waiting to be
+written go into the same file. Overs in the first few seconds only get as
+much pre roll as the ring has had time to fill.
+Turning capturing off stops the writer and frees the ring.
+*/
+struct OverCapture
+{
+    static constexpr double preRollSeconds = 5.0;
+    static constexpr double postRollSeconds = 5.0;
+    
+    // the rest gives the writer time to get round to it
+    static constexpr double ringSeconds = 15.0;
+    
+    // a badly set threshold fills the folder with one file per 10s, stop well before that matters
+    static constexpr int maxCaptures = 1000;
+    
+    OverCapture(const AnalysisHistory& h);
+    ~OverCapture();
+    
+    // whichever thread the host prepares on; reallocates the ring if capturing
+    void prepare(const double& sampleRate, const int& numChannels);
+    
+    // audio thread, channels beyond those prepared for are left out. Only
+    // counts samples while not capturing.
+    void push(const juce::AudioBuffer<float>& main);
+    
+    // message thread, allocates or frees the ring
+    void setCapturing(const bool& shouldCapture);
+    bool isCapturing() const { return capturing.load(std::memory_order_relaxed); }
+    
+    void setRmsThreshold(const float& threshAsDecibels) { rmsThreshold.store(threshAsDecibels, std::memory_order_relaxed); }
+    void setPeakThreshold(const float& threshAsDecibels) { peakThreshold.store(threshAsDecibels, std::memory_order_relaxed); }
+    
+    int getNumCaptured() const { return numCaptured.load(std::memory_order_relaxed); }
+    
+    static juce::File getDirectory();
+    
+    enum EventFlags
+    {
+        Clip      = 1 << 0, // a sample at or over full scale
+        PeakOver  = 1 << 1,
+        RmsOver   = 1 << 2
+    };
+
+private:
+    struct Capture
+    {
+        juce::int64 windowStart = 0;
+        juce::int64 windowEnd = 0;
+        juce::int64 firstEventSample = 0;
+        
+        // wall clock time of the first over
+        juce::int64 firstEventMs = 0;
+        
+        int flags = 0;
+        int numEvents = 0;
+        
+        // the loudest of all the overs, and the thresholds they went over
+        float peakDb = 0.f;
+        float rmsDb = 0.f;
+        int loudestChannel = 0;
+        float peakThreshold = 0.f;
+        float rmsThreshold = 0.f;
+    };
+    
+    struct Writer : juce::Thread
+    {
+        Writer(OverCapture& c) : juce::Thread("Over capture writer"), capture(c) { }
+        void run() override;
+        
+        OverCapture& capture;
+    };
+    
+    // writer thread
+    void scanFrames();
+    void noteFrame(const AnalysisFrame& frame);
+    bool copyFromRing(const juce::int64& start, const int& numSamples);
+    void writeCapture(const Capture& c);
+    
+    // with the control lock held
+    void openRing();
+    void closeRing();
+    void startWriter();
+    void stopWriter();
+    
+    const AnalysisHistory& history;
+    
+    // prepare() and setCapturing() may come from different threads
+    juce::CriticalSection controlLock;
+    std::atomic<bool> capturing { false };
+    
+    // only allocated while capturing, and handed to the audio thread through ringActive
+    juce::AudioBuffer<float> ring;
+    int ringLength = 0;
+    int preparedChannels = 2;
+    double preparedSampleRate = 48000.0;
+    
+    // push() sets pushing before it looks at ringActive, closeRing() clears
+    // ringActive before it looks at pushing, so the ring is never freed under it
+    std::atomic<bool> ringActive { false };
+    std::atomic<bool> pushing { false };
+    
+    // the first sample in the ring since it was opened, set by the audio thread
+    // the first time it sees each new ring
+    std::atomic<juce::uint32> ringGeneration { 0 };
+    juce::uint32 pushedGeneration = 0;
+    std::atomic<juce::int64> ringValidFrom { std::numeric_limits<juce::int64>::max() };
+    
+    // a seqlock, in samples since prepare: claimed goes up before a block is
+    // copied in, written after. Counted whether capturing or not, so they
+    // line up with the analysis frames.
+    std::atomic<juce::int64> numClaimed { 0 };
+    std::atomic<juce::int64> numWritten { 0 };
+    
+    std::atomic<float> rmsThreshold { 0.f };
+    std::atomic<float> peakThreshold { 0.f };
+    std::atomic<int> numCaptured { 0 };
+    
+    // writer thread
+    juce::uint64 nextFrame = 0;
+    Capture pending;
+    bool hasPending = false;
+    bool lastFrameWasOver = false;
+    juce::AudioBuffer<float> scratch;
+    
+    Writer writer { *this };
+};
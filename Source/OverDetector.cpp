@@ -0,0 +1,334 @@
+/*
+  ==============================================================================
+
+    OverDetector.cpp
+    Created: 19 Oct 2026 4:02:37am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "OverDetector.h"
+#include "MeterBallistics.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+// input samples between a sample going in and the interpolator's output around it
+constexpr int truePeakDelay = 6;
+
+} // namespace
+
+//==============================================================================
+const char* OverEvent::getKindName(const Kind& kind)
+{
+    switch ( kind )
+    {
+        case PeakOver:     return "peak";
+        case RmsOver:      return "rms";
+        case ClipRun:      return "clip";
+        case TruePeakOver: return "true peak";
+        case NumKinds:     break;
+    }
+    
+    return "";
+}
+
+//==============================================================================
+void OverDetector::prepare(const double& sampleRate)
+{
+    preparedSampleRate = sampleRate;
+    
+    // the same window the meters' RMS is measured over
+    rmsWindow = juce::jmax(1, juce::roundToInt(sampleRate / MeterBallistics::frameRateHz));
+    rmsSquares.assign(static_cast<size_t>(rmsWindow * Globals::maxChannels), 0.f);
+    releaseSamples = juce::roundToInt(sampleRate * releaseSeconds);
+    
+    channels.fill(ChannelState());
+    samplesProcessed = 0;
+    truePeakOn = false;
+    
+    // windowed sinc, cut off at the input Nyquist, one phase per quarter sample
+    // from truePeakDelay samples back. Phase 0 lands on the sample itself, so
+    // the true peak never reads under the sample peak, and phase 2 halfway
+    // between samples. Each phase sums to 1.
+    constexpr int centre = tapsPerPhase - 1 - truePeakDelay;
+    constexpr double halfWidth = tapsPerPhase / 2 + 0.5;
+    
+    for ( auto phase = 0; phase < oversampling; ++phase )
+    {
+        std::array<double, tapsPerPhase> taps;
+        auto sum = 0.0;
+        
+        // oldest sample first, to match the history
+        for ( auto k = 0; k < tapsPerPhase; ++k )
+        {
+            auto t = k - centre - static_cast<double>(phase) / oversampling;
+            auto sinc = t == 0.0 ? 1.0 : std::sin(juce::MathConstants<double>::pi * t) / (juce::MathConstants<double>::pi * t);
+            auto window = 0.5 + 0.5 * std::cos(juce::MathConstants<double>::pi * t / halfWidth);
+            taps[k] = sinc * window;
+            sum += taps[k];
+        }
+        
+        for ( auto k = 0; k < tapsPerPhase; ++k )
+            truePeakFilter[phase][k] = static_cast<float>(taps[k] / sum);
+    }
+}
+
+void OverDetector::process(const juce::AudioBuffer<float>& main, const juce::int64& hostSample, const bool& measureTruePeak)
+{
+    auto numSamples = main.getNumSamples();
+    
+    blockStartSample = samplesProcessed;
+    blockHostSample = hostSample;
+    blockTimeMs = juce::Time::currentTimeMillis();
+    
+    if ( measureTruePeak != truePeakOn )
+    {
+        for ( auto& state : channels )
+        {
+            // turned back on: samples from before the gap would ring through the interpolator
+            state.truePeakHistory.fill(0.f);
+            state.truePeakPosition = 0;
+            
+            auto& open = state.events[OverEvent::TruePeakOver];
+            
+            if ( open.open )
+            {
+                open.open = false;
+                publish(open.event);
+            }
+        }
+        
+        truePeakOn = measureTruePeak;
+    }
+    
+    peakGain = juce::Decibels::decibelsToGain(peakThreshold.load(std::memory_order_relaxed), -1000.f);
+    auto rmsGain = juce::Decibels::decibelsToGain(rmsThreshold.load(std::memory_order_relaxed), -1000.f);
+    rmsGainSquared = rmsGain * rmsGain;
+    
+    for ( auto start = 0; start < numSamples; start += chunkSize )
+        processChunk(main, start, juce::jmin(chunkSize, numSamples - start));
+    
+    samplesProcessed += numSamples;
+    totalSamples.fetch_add(static_cast<juce::uint64>(numSamples), std::memory_order_relaxed);
+}
+
+void OverDetector::processChunk(const juce::AudioBuffer<float>& main, const int& startSample, const int& numSamples)
+{
+    std::fill(anyOver.begin(), anyOver.begin() + numSamples, false);
+    
+    auto numChannels = juce::jmin(main.getNumChannels(), Globals::maxChannels);
+    auto truePeakGain = juce::Decibels::decibelsToGain(truePeakCeilingDb);
+    
+    for ( auto ch = 0; ch < numChannels; ++ch )
+    {
+        auto* samples = main.getReadPointer(ch, startSample);
+        auto& state = channels[ch];
+        auto* squares = rmsSquares.data() + (ch * rmsWindow);
+        
+        for ( auto i = 0; i < numSamples; ++i )
+        {
+            auto s = samples[i];
+            auto magnitude = std::abs(s);
+            auto sample = startSample + i;
+            
+            auto peakOver = magnitude > peakGain;
+            if ( peakOver || state.events[OverEvent::PeakOver].open )
+                update(ch, OverEvent::PeakOver, peakOver, magnitude, sample);
+            
+            // a run only becomes a clip once it's long enough, and then started where the run did
+            state.clipRun = magnitude >= 1.f ? state.clipRun + 1 : 0;
+            auto clipped = state.clipRun >= clipRunLength;
+            
+            if ( clipped || state.events[OverEvent::ClipRun].open )
+            {
+                // opened where the run started, which may be in the last block
+                if ( state.clipRun == clipRunLength )
+                    update(ch, OverEvent::ClipRun, true, magnitude, sample - (clipRunLength - 1));
+                
+                update(ch, OverEvent::ClipRun, clipped, magnitude, sample);
+            }
+            
+            auto square = s * s;
+            state.sumOfSquares += square - squares[state.rmsPosition];
+            squares[state.rmsPosition] = square;
+            
+            // the running sum drifts, so it's added up afresh once a window
+            if ( ++state.rmsPosition == rmsWindow )
+            {
+                state.rmsPosition = 0;
+                state.sumOfSquares = 0.0;
+                
+                for ( auto k = 0; k < rmsWindow; ++k )
+                    state.sumOfSquares += squares[k];
+            }
+            
+            auto meanSquare = static_cast<float>(state.sumOfSquares / rmsWindow);
+            auto rmsOver = meanSquare > rmsGainSquared;
+            
+            if ( rmsOver || state.events[OverEvent::RmsOver].open )
+                update(ch, OverEvent::RmsOver, rmsOver, std::sqrt(meanSquare), sample);
+            
+            auto truePeakOver = false;
+            
+            if ( truePeakOn )
+            {
+                auto truePeak = getTruePeak(state, s);
+                truePeakOver = truePeak > truePeakGain;
+            
+                if ( truePeakOver || state.events[OverEvent::TruePeakOver].open )
+                    update(ch, OverEvent::TruePeakOver, truePeakOver, truePeak, sample - truePeakDelay);
+            }
+            
+            anyOver[i] = anyOver[i] || peakOver || clipped || rmsOver || truePeakOver;
+        }
+    }
+    
+    auto count = std::count(anyOver.begin(), anyOver.begin() + numSamples, true);
+    samplesOver.fetch_add(static_cast<juce::uint64>(count), std::memory_order_relaxed);
+}
+
+float OverDetector::getTruePeak(ChannelState& state, const float& sample) const
+{
+    auto position = state.truePeakPosition;
+    state.truePeakHistory[position] = sample;
+    state.truePeakHistory[position + tapsPerPhase] = sample;
+    state.truePeakPosition = (position + 1) % tapsPerPhase;
+    
+    // the last tapsPerPhase samples in order, oldest first
+    auto* history = state.truePeakHistory.data() + position + 1;
+    auto peak = 0.f;
+    
+    for ( const auto& phase : truePeakFilter )
+    {
+        auto value = 0.f;
+        
+        for ( auto k = 0; k < tapsPerPhase; ++k )
+            value += phase[k] * history[k];
+        
+        peak = juce::jmax(peak, std::abs(value));
+    }
+    
+    return peak;
+}
+
+void OverDetector::update(const int& channel, const OverEvent::Kind& kind, const bool& isOver, const float& level, const int& sample)
+{
+    auto& open = channels[channel].events[kind];
+    auto position = blockStartSample + sample;
+    
+    if ( !isOver )
+    {
+        auto release = kind == OverEvent::ClipRun ? 0 : releaseSamples;
+        
+        if ( position - open.lastOver > release )
+        {
+            open.open = false;
+            publish(open.event);
+        }
+        
+        return;
+    }
+    
+    if ( !open.open )
+    {
+        open.open = true;
+        open.event.startSample = position;
+        open.event.hostSample = blockHostSample >= 0 ? blockHostSample + sample : -1;
+        open.event.timeMs = blockTimeMs;
+        open.event.maxDb = 0.f;
+        open.event.kind = kind;
+        open.event.channel = static_cast<juce::uint8>(channel);
+    }
+    
+    // linear until it's published
+    open.event.maxDb = juce::jmax(open.event.maxDb, level);
+    open.event.length = position - open.event.startSample + 1;
+    open.lastOver = position;
+}
+
+void OverDetector::publish(const OverEvent& event)
+{
+    numEvents[event.kind].fetch_add(1, std::memory_order_relaxed);
+    storeMax(longestOver, event.length);
+    
+    if ( event.kind == OverEvent::ClipRun )
+        storeMax(longestClipRun, event.length);
+    
+    auto write = fifo.write(1);
+    
+    if ( write.blockSize1 == 0 )
+    {
+        numDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    auto& slot = queue[write.startIndex1];
+    slot = event;
+    slot.maxDb = juce::Decibels::gainToDecibels(event.maxDb, -100.f);
+}
+
+void OverDetector::storeMax(std::atomic<juce::int64>& destination, const juce::int64& value)
+{
+    // only the audio thread raises it, so there's nobody to race
+    if ( value > destination.load(std::memory_order_relaxed) )
+        destination.store(value, std::memory_order_relaxed);
+}
+
+//==============================================================================
+bool OverDetector::pull(OverEvent& event)
+{
+    auto read = fifo.read(1);
+    
+    if ( read.blockSize1 == 0 )
+        return false;
+    
+    event = queue[read.startIndex1];
+    return true;
+}
+
+OverDetector::Totals OverDetector::getTotals() const
+{
+    Totals totals;
+    
+    for ( auto kind = 0; kind < OverEvent::NumKinds; ++kind )
+        totals.numEvents[kind] = numEvents[kind].load(std::memory_order_relaxed);
+    
+    totals.longestClipRun = longestClipRun.load(std::memory_order_relaxed);
+    totals.longestOver = longestOver.load(std::memory_order_relaxed);
+    totals.samplesOver = samplesOver.load(std::memory_order_relaxed);
+    totals.samplesProcessed = totalSamples.load(std::memory_order_relaxed);
+    totals.numDropped = numDropped.load(std::memory_order_relaxed);
+    
+    return totals;
+}
+
+void OverDetector::resetTotals()
+{
+    for ( auto& count : numEvents )
+        count.store(0, std::memory_order_relaxed);
+    
+    longestClipRun.store(0, std::memory_order_relaxed);
+    longestOver.store(0, std::memory_order_relaxed);
+    samplesOver.store(0, std::memory_order_relaxed);
+    totalSamples.store(0, std::memory_order_relaxed);
+    numDropped.store(0, std::memory_order_relaxed);
+}
+
+juce::uint64 OverDetector::Totals::getNumEvents() const
+{
+    juce::uint64 total = 0;
+    
+    for ( auto count : numEvents )
+        total += count;
+    
+    return total;
+}
+
+float OverDetector::Totals::getPercentOver() const
+{
+    return samplesProcessed == 0 ? 0.f : static_cast<float>(100.0 * samplesOver / samplesProcessed);
+}
@@ -0,0 +1,184 @@
+/*
+  ==============================================================================
+
+    OverDetector.h
+    Created: 19 Oct 2026 4:02:37am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+#include "Globals.h"
+
+//==============================================================================
+/*
+One over on one channel, from its first sample to its last.
+*/
+struct OverEvent
+{
+    enum Kind : juce::uint8
+    {
+        PeakOver,     // sample peak over the peak threshold
+        RmsOver,      // 25ms sliding RMS over the RMS threshold
+        ClipRun,      // clipRunLength or more consecutive samples at full scale
+        TruePeakOver, // 4x oversampled peak over the true peak ceiling
+        NumKinds
+    };
+    
+    // samples since prepare
+    juce::int64 startSample = 0;
+    juce::int64 length = 0;
+    
+    // where the host timeline was at the first sample, -1 without a play head or while stopped
+    juce::int64 hostSample = -1;
+    
+    // wall clock at the start of the block it began in
+    juce::int64 timeMs = 0;
+    
+    // the highest level reached, in dBFS (dBTP for true peak)
+    float maxDb = 0.f;
+    
+    Kind kind = PeakOver;
+    juce::uint8 channel = 0;
+    
+    static const char* getKindName(const Kind& kind);
+};
+
+//==============================================================================
+/*
+Sample accurate over detection on the main bus, run in processBlock.
+Each over is published once it ends, through a wait-free single producer /
+single consumer queue, and is counted in totals the message thread can read
+at any time. When the queue is full events are dropped but the totals stay
+exact. The true peak interpolator is the one costly part, so it only runs
+while asked for; the other kinds are always detected. Everything is
+allocated in prepare.
+*/
+struct OverDetector
+{
+    // EBU R 128 maximum true peak
+    static constexpr float truePeakCeilingDb = -1.f;
+    
+    // fewer consecutive samples at full scale are more likely a loud transient than a clip
+    static constexpr int clipRunLength = 3;
+    
+    // an over only ends once the level has stayed under this long, so a loud
+    // waveform going over every half cycle is one event rather than hundreds.
+    // Clip runs end at the first sample under, their length is the point.
+    static constexpr double releaseSeconds = 0.01;
+    
+    static constexpr int queueCapacity = 4096;
+    
+    // audio thread never calls this
+    void prepare(const double& sampleRate);
+    
+    // message thread
+    void setRmsThreshold(const float& threshAsDecibels) { rmsThreshold.store(threshAsDecibels, std::memory_order_relaxed); }
+    void setPeakThreshold(const float& threshAsDecibels) { peakThreshold.store(threshAsDecibels, std::memory_order_relaxed); }
+    
+    // audio thread; hostSample is the timeline position of the first sample, -1 if unknown.
+    // A true peak over still open when measureTruePeak goes off ends there
+    void process(const juce::AudioBuffer<float>& main, const juce::int64& hostSample, const bool& measureTruePeak = true);
+    
+    // message thread, the oldest event first
+    bool pull(OverEvent& event);
+    
+    struct Totals
+    {
+        std::array<juce::uint64, OverEvent::NumKinds> numEvents {};
+        juce::int64 longestClipRun = 0;
+        juce::int64 longestOver = 0;
+        
+        // with any channel over anything
+        juce::uint64 samplesOver = 0;
+        juce::uint64 samplesProcessed = 0;
+        
+        juce::uint64 numDropped = 0;
+        
+        juce::uint64 getNumEvents() const;
+        float getPercentOver() const;
+    };
+    
+    Totals getTotals() const;
+    
+    // the queue is left alone, its events are the consumer's to throw away
+    void resetTotals();
+    
+    double getSampleRate() const { return preparedSampleRate; }
+    
+    // the true peak interpolator, 12 taps for each of 4 phases
+    static constexpr int oversampling = 4;
+    static constexpr int tapsPerPhase = 12;
+
+private:
+    struct OpenEvent
+    {
+        bool open = false;
+        OverEvent event;
+        juce::int64 lastOver = 0;
+    };
+    
+    struct ChannelState
+    {
+        std::array<OpenEvent, OverEvent::NumKinds> events;
+        int clipRun = 0;
+        
+        // squares of the last rmsWindow samples, and their sum
+        int rmsPosition = 0;
+        double sumOfSquares = 0.0;
+        
+        // the last tapsPerPhase samples, twice over so the filter never wraps
+        std::array<float, tapsPerPhase * 2> truePeakHistory {};
+        int truePeakPosition = 0;
+    };
+    
+    void processChunk(const juce::AudioBuffer<float>& main, const int& startSample, const int& numSamples);
+    
+    void update(const int& channel, const OverEvent::Kind& kind, const bool& isOver, const float& level, const int& sample);
+    void publish(const OverEvent& event);
+    
+    float getTruePeak(ChannelState& state, const float& sample) const;
+    
+    static void storeMax(std::atomic<juce::int64>& destination, const juce::int64& value);
+    
+    double preparedSampleRate = 48000.0;
+    int rmsWindow = 1200;
+    int releaseSamples = 480;
+    bool truePeakOn = false;
+    
+    std::array<ChannelState, Globals::maxChannels> channels;
+    std::vector<float> rmsSquares;
+    std::array<std::array<float, tapsPerPhase>, oversampling> truePeakFilter;
+    
+    // where the block being processed stands
+    juce::int64 samplesProcessed = 0;
+    juce::int64 blockStartSample = 0;
+    juce::int64 blockHostSample = -1;
+    juce::int64 blockTimeMs = 0;
+    
+    // per sample of a chunk, whether any channel was over anything
+    static constexpr int chunkSize = 256;
+    std::array<bool, chunkSize> anyOver {};
+    
+    float rmsGainSquared = 1.f;
+    float peakGain = 1.f;
+    
+    std::atomic<float> rmsThreshold { 0.f };
+    std::atomic<float> peakThreshold { 0.f };
+    
+    std::array<OverEvent, queueCapacity> queue;
+    juce::AbstractFifo fifo { queueCapacity };
+    
+    std::array<std::atomic<juce::uint64>, OverEvent::NumKinds> numEvents {};
+    std::atomic<juce::int64> longestClipRun { 0 };
+    std::atomic<juce::int64> longestOver { 0 };
+    std::atomic<juce::uint64> samplesOver { 0 };
+    std::atomic<juce::uint64> totalSamples { 0 };
+    std::atomic<juce::uint64> numDropped { 0 };
+};
@@ -0,0 +1,183 @@
+/*
+  ==============================================================================
+
+    OverEventLog.cpp
+    Created: 19 Oct 2026 4:41:13am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "OverEventLog.h"
+#include "MyColours.h"
+
+namespace
+{
+
+constexpr int lineHeight = 16;
+
+// the totals take three lines and a gap
+constexpr int headerHeight = lineHeight * 3 + 8 + 10;
+
+// shared by the heading and the rows so they line up
+void drawColumns(juce::Graphics& g, const juce::StringArray& columns, const juce::Rectangle<float>& area)
+{
+    static constexpr float widths[] = { 0.16f, 0.22f, 0.16f, 0.08f, 0.16f, 0.22f };
+    auto x = area.getX();
+    
+    for ( auto i = 0; i < columns.size() && i < 6; ++i )
+    {
+        auto columnWidth = widths[i] * area.getWidth();
+        g.drawText(columns[i], juce::Rectangle<float>(x, area.getY(), columnWidth, area.getHeight()), juce::Justification::centredLeft);
+        x += columnWidth;
+    }
+}
+
+} // namespace
+
+//==============================================================================
+OverEventLog::OverEventLog(OverDetector& d)
+    : detector(d)
+{
+    list.setModel(this);
+    list.setRowHeight(lineHeight);
+    list.setColour(juce::ListBox::backgroundColourId, juce::Colours::transparentBlack);
+    addAndMakeVisible(list);
+}
+
+void OverEventLog::pullEvents()
+{
+    OverEvent event;
+    auto numPulled = 0;
+    
+    while ( detector.pull(event) )
+    {
+        events.push_back(event);
+        ++numPulled;
+    }
+    
+    while ( static_cast<int>(events.size()) > maxEvents )
+        events.pop_front();
+    
+    totals = detector.getTotals();
+    
+    if ( numPulled > 0 && isVisible() )
+        list.updateContent();
+    
+    if ( isVisible() )
+        repaint(getLocalBounds().removeFromTop(headerHeight));
+}
+
+void OverEventLog::paint(juce::Graphics& g)
+{
+    g.fillAll(MyColours::getColour(MyColours::Background).withAlpha(0.92f));
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.setFont(resources->getFont());
+    
+    auto textArea = getLocalBounds().reduced(10).removeFromTop(headerHeight - 10);
+    auto sampleRate = detector.getSampleRate();
+    
+    auto drawLine = [&](const juce::String& left, const juce::String& right)
+    {
+        auto line = textArea.removeFromTop(lineHeight);
+        g.drawText(left, line, juce::Justification::centredLeft);
+        g.drawText(right, line, juce::Justification::centredRight);
+    };
+    
+    auto ms = [sampleRate](const juce::int64& samples) { return juce::String(1000.0 * samples / sampleRate, 1) + "ms"; };
+    
+    drawLine("OVERS " + juce::String(totals.getNumEvents())
+             + "   clip " + juce::String(totals.numEvents[OverEvent::ClipRun])
+             + "   peak " + juce::String(totals.numEvents[OverEvent::PeakOver])
+             + "   rms " + juce::String(totals.numEvents[OverEvent::RmsOver])
+             + "   true peak " + juce::String(totals.numEvents[OverEvent::TruePeakOver]),
+             "click to reset");
+    
+    drawLine("longest clip run " + juce::String(totals.longestClipRun) + " samples"
+             + "   longest over " + ms(totals.longestOver)
+             + "   time over " + juce::String(totals.getPercentOver(), 3) + "%",
+             totals.numDropped > 0 ? juce::String(totals.numDropped) + " not listed" : juce::String());
+    
+    textArea.removeFromTop(8);
+    drawColumns(g, { "time", "position", "kind", "ch", "length", "level" }, textArea.removeFromTop(lineHeight).toFloat());
+}
+
+void OverEventLog::visibilityChanged()
+{
+    // the list isn't kept up to date while it's hidden
+    if ( isVisible() )
+        list.updateContent();
+}
+
+void OverEventLog::resized()
+{
+    list.setBounds(getLocalBounds().reduced(10, 0).withTrimmedTop(headerHeight).withTrimmedBottom(10));
+}
+
+void OverEventLog::mouseDown(const juce::MouseEvent& e)
+{
+    // the list takes clicks on its rows, this is the totals
+    juce::ignoreUnused(e);
+    
+    detector.resetTotals();
+    events.clear();
+    list.updateContent();
+    
+    pullEvents();
+    repaint();
+}
+
+//==============================================================================
+int OverEventLog::getNumRows()
+{
+    return static_cast<int>(events.size());
+}
+
+void OverEventLog::paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected)
+{
+    if ( rowNumber < 0 || rowNumber >= getNumRows() )
+        return;
+    
+    const auto& event = events[events.size() - 1 - static_cast<size_t>(rowNumber)];
+    
+    if ( rowIsSelected )
+        g.fillAll(MyColours::getColour(MyColours::Text).withAlpha(0.15f));
+    
+    auto isClip = event.kind == OverEvent::ClipRun || event.kind == OverEvent::TruePeakOver;
+    g.setColour(MyColours::getColour(isClip ? MyColours::RedBright : MyColours::Text));
+    g.setFont(resources->getFont());
+    
+    // a clip run is short enough that samples say more than milliseconds
+    auto length = event.kind == OverEvent::ClipRun ? juce::String(event.length) + " smp"
+                                                   : juce::String(1000.0 * event.length / detector.getSampleRate(), 1) + "ms";
+    
+    auto unit = event.kind == OverEvent::TruePeakOver ? " dBTP" : " dBFS";
+    
+    drawColumns(g,
+                {
+                    juce::Time(event.timeMs).formatted("%H:%M:%S"),
+                    getHostTimeText(event),
+                    OverEvent::getKindName(event.kind),
+                    juce::String(event.channel + 1),
+                    length,
+                    juce::String(event.maxDb, 2) + unit
+                },
+                juce::Rectangle<float>(0.f, 0.f, static_cast<float>(width), static_cast<float>(height)));
+}
+
+juce::String OverEventLog::getHostTimeText(const OverEvent& event) const
+{
+    // no play head, or it didn't say where it was
+    if ( event.hostSample < 0 )
+        return "-";
+    
+    auto totalMs = static_cast<juce::int64>(1000.0 * event.hostSample / detector.getSampleRate());
+    auto hours = totalMs / 3600000;
+    auto minutes = (totalMs / 60000) % 60;
+    auto seconds = (totalMs / 1000) % 60;
+    
+    return juce::String(hours) + ":" + juce::String(minutes).paddedLeft('0', 2)
+           + ":" + juce::String(seconds).paddedLeft('0', 2)
+           + "." + juce::String(totalMs % 1000).paddedLeft('0', 3);
+}
@@ -0,0 +1,54 @@
+/*
+  ==============================================================================
+
+    OverEventLog.h
+    Created: 19 Oct 2026 4:41:13am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <deque>
+#include "OverDetector.h"
+#include "SharedRenderResources.h"
+
+//==============================================================================
+/*
+Hidden overlay listing every over the detector has found, newest first, under
+the totals since they were last reset. Click the totals to reset them and
+clear the list.
+The editor drains the detector's queue into it whether it's showing or not,
+so nothing is missed while it's hidden.
+*/
+struct OverEventLog : juce::Component, juce::ListBoxModel
+{
+    // the oldest are forgotten past this, the totals still count them
+    static constexpr int maxEvents = 10000;
+    
+    OverEventLog(OverDetector& d);
+    
+    // message thread, from the editor's timer
+    void pullEvents();
+    
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void visibilityChanged() override;
+    void mouseDown(const juce::MouseEvent& e) override;
+    
+    int getNumRows() override;
+    void paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
+
+private:
+    juce::String getHostTimeText(const OverEvent& event) const;
+    
+    OverDetector& detector;
+    OverDetector::Totals totals;
+    
+    std::deque<OverEvent> events;
+    juce::ListBox list;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
@@ -0,0 +1,361 @@
+/*
+  ==============================================================================
+
+    PlayPositionCache.cpp
+    Created: 19 Oct 2026 5:12:48am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "PlayPositionCache.h"
+#include "MeterBallistics.h"
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+
+// a loudness window reaches back this far from the end of a frame, counting the
+// 100ms step it may be waiting on, so only after this many frames on the
+// timeline does it hold nothing from before a jump
+const int momentaryFrames = juce::roundToInt((0.4 + 0.1) * MeterBallistics::frameRateHz);
+const int shortTermFrames = juce::roundToInt((3.0 + 0.1) * MeterBallistics::frameRateHz);
+
+SessionTimeline::Record getUnknownRecord()
+{
+    SessionTimeline::Record record {};
+    record.peak.fill(PlayPositionCache::unknown);
+    record.rms.fill(PlayPositionCache::unknown);
+    record.momentaryLufs = PlayPositionCache::unknown;
+    record.shortTermLufs = PlayPositionCache::unknown;
+    
+    return record;
+}
+
+double toEnergy(const float& lufs)
+{
+    return std::pow(10.0, (lufs + 0.691) / 10.0);
+}
+
+} // namespace
+
+//==============================================================================
+PlayPositionCache::PlayPositionCache(const AnalysisHistory& h)
+    : history(h), regionScratch(std::make_unique<RegionScratch>())
+{
+}
+
+PlayPositionCache::~PlayPositionCache()
+{
+    stop();
+}
+
+void PlayPositionCache::prepare(const double& sampleRate)
+{
+    {
+        const juce::ScopedLock sl(lock);
+        
+        // the same length FrameAnalyzer uses
+        slotLength.store(juce::jmax(1, juce::roundToInt(sampleRate / MeterBallistics::frameRateHz)), std::memory_order_relaxed);
+        stepLength = LoudnessAnalyzer::getStepLength(sampleRate);
+        
+        pages.clear();
+        nextFrame = history.getNumWritten();
+        ++generation;
+        lastHostEnd = -1;
+        framesOnTimeline = 0;
+    }
+    
+    revision.fetch_add(1, std::memory_order_release);
+}
+    
+void PlayPositionCache::start()
+{
+    if ( writer.isThreadRunning() )
+        return;
+    
+    {
+        const juce::ScopedLock sl(lock);
+        
+        // frames from before were measured without loudness, so the writer
+        // starts from now as if the transport had just jumped
+        nextFrame = history.getNumWritten();
+        ++generation;
+        lastHostEnd = -1;
+        framesOnTimeline = 0;
+    }
+    
+    running.store(true, std::memory_order_relaxed);
+    writer.startThread();
+}
+
+void PlayPositionCache::stop()
+{
+    running.store(false, std::memory_order_relaxed);
+    
+    writer.signalThreadShouldExit();
+    writer.notify();
+    writer.stopThread(2000);
+}
+
+//==============================================================================
+void PlayPositionCache::Writer::run()
+{
+    while ( !threadShouldExit() )
+    {
+        cache.drain();
+        wait(pollIntervalMs);
+    }
+}
+
+void PlayPositionCache::drain()
+{
+    auto stored = false;
+    
+    // frames are copied out of the history without the lock and only stored
+    // with it, so readers wait for at most a batch to be stored
+    for ( ;; )
+    {
+        juce::uint64 first = 0;
+        juce::uint64 readFor = 0;
+        
+        {
+            const juce::ScopedLock sl(lock);
+    
+            // frames missed leave a gap on the timeline, which store() takes as a jump
+            nextFrame = juce::jmax(nextFrame, history.getOldestAvailable());
+            first = nextFrame;
+            readFor = generation;
+        }
+    
+        auto count = juce::jmin(history.getNumWritten() - first, static_cast<juce::uint64>(framesPerBatch));
+    
+        if ( count == 0 )
+            break;
+        
+        size_t numRead = 0;
+        
+        for ( juce::uint64 i = 0; i < count; ++i )
+        {
+            if ( history.read(first + i, batch[numRead]) )
+                ++numRead;
+        }
+        
+        const juce::ScopedLock sl(lock);
+        
+        // set back while the batch was being read
+        if ( generation != readFor )
+            continue;
+        
+        for ( size_t i = 0; i < numRead; ++i )
+            store(batch[i]);
+        
+        nextFrame = first + count;
+        stored = stored || numRead > 0;
+    }
+    
+    if ( stored )
+        revision.fetch_add(1, std::memory_order_release);
+}
+
+void PlayPositionCache::store(const AnalysisFrame& frame)
+{
+    auto length = slotLength.load(std::memory_order_relaxed);
+    
+    if ( frame.hostEndSample < 0 )
+    {
+        lastHostEnd = -1;
+        framesOnTimeline = 0;
+        return;
+    }
+    
+    framesOnTimeline = frame.hostEndSample == lastHostEnd + length ? framesOnTimeline + 1 : 1;
+    lastHostEnd = frame.hostEndSample;
+    
+    // pre-roll before the start of the timeline isn't kept
+    auto centre = frame.hostEndSample - (length / 2);
+    if ( centre < 0 )
+        return;
+    
+    auto slot = centre / length;
+    auto* page = getPage(slot / slotsPerPage, true);
+    auto index = static_cast<size_t>(slot % slotsPerPage);
+    
+    // a slot is where, not when
+    auto record = SessionTimeline::makeRecord(frame, frame.timeMs);
+    auto& stored = page->slots[index];
+    auto changed = true;
+    
+    // BS.1770 gating blocks are taken once per 100ms step, so only a frame a step
+    // finished in holds a new one. Steps are counted from the same sample as
+    // frames, and a frame is shorter than a step, so there's never more than one.
+    auto finishedStep = frame.endSample / stepLength != (frame.endSample - length) / stepLength;
+    auto momentaryBlock = finishedStep;
+    auto shortTermBlock = finishedStep;
+    
+    if ( page->filled[index] )
+    {
+        auto tolerance = static_cast<int>(changeToleranceDb * 100.f);
+        
+        changed = std::abs(record.peak[Main] - stored.peak[Main]) > tolerance
+               || std::abs(record.rms[Main] - stored.rms[Main]) > tolerance;
+        
+        if ( changed )
+            numChanged.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    // too soon after a jump to trust, so keep what the last pass measured if it was the same audio
+    if ( framesOnTimeline < momentaryFrames )
+    {
+        record.momentaryLufs = changed ? unknown : stored.momentaryLufs;
+        momentaryBlock = !changed && page->momentaryBlocks[index];
+    }
+    
+    if ( framesOnTimeline < shortTermFrames )
+    {
+        record.shortTermLufs = changed ? unknown : stored.shortTermLufs;
+        shortTermBlock = !changed && page->shortTermBlocks[index];
+    }
+    
+    stored = record;
+    page->filled[index] = true;
+    page->momentaryBlocks[index] = momentaryBlock;
+    page->shortTermBlocks[index] = shortTermBlock;
+}
+
+PlayPositionCache::Page* PlayPositionCache::getPage(const juce::int64& pageIndex, const bool& create)
+{
+    auto found = pages.find(pageIndex);
+    
+    if ( found != pages.end() )
+    {
+        found->second->lastUsed = ++useCount;
+        return found->second.get();
+    }
+    
+    if ( !create )
+        return nullptr;
+    
+    if ( pages.size() >= maxPages )
+    {
+        auto oldest = pages.begin();
+        
+        for ( auto it = pages.begin(); it != pages.end(); ++it )
+        {
+            if ( it->second->lastUsed < oldest->second->lastUsed )
+                oldest = it;
+        }
+        
+        pages.erase(oldest);
+    }
+    
+    auto& page = pages[pageIndex];
+    page = std::make_unique<Page>();
+    page->lastUsed = ++useCount;
+    
+    return page.get();
+}
+
+//==============================================================================
+int PlayPositionCache::read(const juce::int64& firstSlot, SessionTimeline::Record* destination, const int& numSlots)
+{
+    const juce::ScopedLock sl(lock);
+    
+    auto unknownRecord = getUnknownRecord();
+    auto numFilled = 0;
+    
+    for ( auto i = 0; i < numSlots; ++i )
+    {
+        auto slot = firstSlot + i;
+        auto* page = slot >= 0 ? getPage(slot / slotsPerPage, false) : nullptr;
+        auto index = static_cast<size_t>(slot % slotsPerPage);
+        
+        if ( page != nullptr && page->filled[index] )
+        {
+            destination[i] = page->slots[index];
+            ++numFilled;
+        }
+        else
+        {
+            destination[i] = unknownRecord;
+        }
+    }
+    
+    return numFilled;
+}
+
+PlayPositionCache::Region PlayPositionCache::getRegion(const juce::int64& startSample, const juce::int64& endSample)
+{
+    Region region;
+    
+    auto length = slotLength.load(std::memory_order_relaxed);
+    auto firstSlot = juce::jmax(juce::int64(0), startSample / length);
+    auto endSlot = (endSample + length - 1) / length;
+    
+    if ( endSlot <= firstSlot )
+        return region;
+    
+    auto& page = regionScratch->page;
+    auto& momentaryBlocks = regionScratch->momentaryBlocks;
+    auto& shortTermBlocks = regionScratch->shortTermBlocks;
+    momentaryBlocks.clear();
+    shortTermBlocks.clear();
+    
+    juce::int64 numFilled = 0;
+    
+    for ( auto slot = firstSlot; slot < endSlot; )
+    {
+        auto pageIndex = slot / slotsPerPage;
+        auto pageStart = pageIndex * slotsPerPage;
+        auto first = static_cast<size_t>(slot - pageStart);
+        auto end = static_cast<size_t>(juce::jmin(endSlot - pageStart, static_cast<juce::int64>(slotsPerPage)));
+        slot = pageStart + slotsPerPage;
+        
+        // the lock is only held for the copy, so the writer is never kept waiting for long
+        {
+            const juce::ScopedLock sl(lock);
+            auto* stored = getPage(pageIndex, false);
+        
+            if ( stored == nullptr )
+                continue;
+            
+            page = *stored;
+        }
+        
+        for ( auto index = first; index < end; ++index )
+        {
+            if ( !page.filled[index] )
+                continue;
+            
+            const auto& record = page.slots[index];
+            ++numFilled;
+            
+            region.peakDb = juce::jmax(region.peakDb, SessionTimeline::Record::toDb(record.peak[Main]));
+            
+            if ( record.momentaryLufs != unknown )
+            {
+                auto lufs = SessionTimeline::Record::toDb(record.momentaryLufs);
+                region.maxMomentaryLufs = juce::jmax(region.maxMomentaryLufs, lufs);
+                
+                if ( page.momentaryBlocks[index] && lufs > LoudnessAnalyzer::minLufs )
+                    momentaryBlocks.add(toEnergy(lufs));
+            }
+            
+            if ( record.shortTermLufs != unknown )
+            {
+                auto lufs = SessionTimeline::Record::toDb(record.shortTermLufs);
+                region.maxShortTermLufs = juce::jmax(region.maxShortTermLufs, lufs);
+                
+                if ( page.shortTermBlocks[index] && lufs > LoudnessAnalyzer::minLufs )
+                    shortTermBlocks.add(toEnergy(lufs));
+            }
+        }
+    }
+    
+    region.integratedLufs = LoudnessAnalyzer::getIntegratedLufs(momentaryBlocks);
+    region.loudnessRange = LoudnessAnalyzer::getLoudnessRange(shortTermBlocks);
+    region.coverage = static_cast<float>(numFilled) / static_cast<float>(endSlot - firstSlot);
+    
+    return region;
+}
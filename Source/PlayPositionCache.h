@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    PlayPositionCache.h
+    Created: 19 Oct 2026 5:12:48am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <bitset>
+#include <map>
+#include <memory>
+#include "AnalysisHistory.h"
+#include "LoudnessAnalyzer.h"
+#include "SessionTimeline.h"
+
+//==============================================================================
+/*
+Levels and loudness indexed by where they were on the host timeline rather
+than when they were measured, so a looped or replayed section can show what
+was measured there last time straight away, and be summed up as a region.
+The timeline is cut into slots of one analysis frame each and every frame
+played straight through is stored in the slot its centre falls in, in the
+session timeline's compact record, replacing whatever was there. Momentary
+and short-term loudness are only stored once the transport has run long
+enough for their windows to hold nothing from before a jump; until then a
+slot keeps its old values, unless its levels have changed enough that the
+audio there must have been edited, in which case they're forgotten.
+Slots are kept in pages, the least recently used of which are dropped past
+maxPages. A background thread follows the AnalysisHistory and fills them in,
+between start() and stop(), and the processor only measures loudness while
+it runs.
+*/
+struct PlayPositionCache
+{
+    // 25.6s at 40 frames per second
+    static constexpr int slotsPerPage = 1024;
+    
+    // 16KB each, so 8MB and a little over 3.5 hours of timeline
+    static constexpr size_t maxPages = 512;
+    
+    // a slot whose peak or RMS moves further than this between passes is taken to hold different audio
+    static constexpr float changeToleranceDb = 1.f;
+    
+    static constexpr int pollIntervalMs = 100;
+    
+    // frames the writer copies out of the history before taking the lock to store them
+    static constexpr int framesPerBatch = 64;
+    
+    PlayPositionCache(const AnalysisHistory& h);
+    ~PlayPositionCache();
+    
+    // message thread; forgets everything, slots are a frame long at this rate
+    void prepare(const double& sampleRate);
+    
+    // message thread. Not started on construction or prepare, so plugin scans
+    // and instances nobody looks at don't start a thread
+    void start();
+    void stop();
+    bool isRunning() const { return running.load(std::memory_order_relaxed); }
+    
+    // in host timeline samples
+    int getSlotLength() const { return slotLength.load(std::memory_order_relaxed); }
+    
+    /*
+    Copies numSlots slots from firstSlot on. Slots nothing was stored in, and
+    values that aren't known, read as Record::quantize(NaN). Returns how many
+    slots had anything in them.
+    */
+    int read(const juce::int64& firstSlot, SessionTimeline::Record* destination, const int& numSlots);
+    
+    // bumped whenever a slot is stored or dropped, so readers know when to look again
+    juce::uint64 getRevision() const { return revision.load(std::memory_order_acquire); }
+    
+    // slots stored where the levels showed the audio had changed
+    juce::uint64 getNumChanged() const { return numChanged.load(std::memory_order_relaxed); }
+    
+    struct Region
+    {
+        float peakDb = Globals::negInf();
+        float maxMomentaryLufs = LoudnessAnalyzer::minLufs;
+        float maxShortTermLufs = LoudnessAnalyzer::minLufs;
+        float integratedLufs = LoudnessAnalyzer::minLufs;
+        float loudnessRange = 0.f;
+        
+        // of the slots in the region, 0 to 1
+        float coverage = 0.f;
+    };
+    
+    // from what's stored, without going near the audio; integrated and range are
+    // gated the BS.1770 way from the momentary and short-term values of the slots
+    // each 100ms loudness step finished in. One thread only (the message thread):
+    // it works in scratch space the cache keeps for it
+    Region getRegion(const juce::int64& startSample, const juce::int64& endSample);
+    
+    static constexpr juce::int16 unknown = -32768;
+
+private:
+    struct Page
+    {
+        std::array<SessionTimeline::Record, slotsPerPage> slots;
+        std::bitset<slotsPerPage> filled;
+        
+        // slots whose momentary or short-term value is a gating block, kept along with the value
+        std::bitset<slotsPerPage> momentaryBlocks;
+        std::bitset<slotsPerPage> shortTermBlocks;
+        juce::uint64 lastUsed = 0;
+    };
+    
+    // getRegion() copies a page at a time here with the lock held, and sums it up after
+    struct RegionScratch
+    {
+        Page page;
+        LoudnessAnalyzer::GatingHistogram momentaryBlocks;
+        LoudnessAnalyzer::GatingHistogram shortTermBlocks;
+    };
+    
+    struct Writer : juce::Thread
+    {
+        Writer(PlayPositionCache& c) : juce::Thread("Play position cache"), cache(c) { }
+        void run() override;
+        
+        PlayPositionCache& cache;
+    };
+    
+    // writer thread
+    void drain();
+    void store(const AnalysisFrame& frame);
+    
+    // with the lock held
+    Page* getPage(const juce::int64& pageIndex, const bool& create);
+    
+    const AnalysisHistory& history;
+    
+    juce::CriticalSection lock;
+    std::map<juce::int64, std::unique_ptr<Page>> pages;
+    juce::uint64 useCount = 0;
+    
+    std::atomic<bool> running { false };
+    std::atomic<int> slotLength { 1200 };
+    std::atomic<juce::uint64> revision { 0 };
+    std::atomic<juce::uint64> numChanged { 0 };
+    
+    // with the lock held; generation goes up whenever prepare() or start() sets
+    // the writer back, so a batch read from before then is thrown away
+    int stepLength = 4800;
+    juce::uint64 nextFrame = 0;
+    juce::uint64 generation = 0;
+    juce::int64 lastHostEnd = -1;
+    int framesOnTimeline = 0;
+    
+    // writer thread
+    std::array<AnalysisFrame, framesPerBatch> batch;
+    
+    // getRegion()'s, 48KB so on the heap
+    std::unique_ptr<RegionScratch> regionScratch;
+    
+    Writer writer { *this };
+};
@@ -0,0 +1,221 @@
+/*
+  ==============================================================================
+
+    PlayPositionView.cpp
+    Created: 19 Oct 2026 5:38:20am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "PlayPositionView.h"
+#include "MyColours.h"
+#include "Globals.h"
+
+//==============================================================================
+void PlayPositionView::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds();
+    
+    g.fillAll(MyColours::getColour(MyColours::Background).withAlpha(0.96f));
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.setFont(resources->getFont());
+    
+    auto summaryArea = bounds.removeFromBottom(16).reduced(4, 0);
+    auto labelArea = bounds.removeFromBottom(16).reduced(4, 0);
+    auto plotArea = bounds.reduced(0, 4);
+    
+    if ( playPosition < 0 )
+    {
+        g.drawText("PLAY POSITION: waiting for the transport", plotArea, juce::Justification::centred);
+        return;
+    }
+    
+    cache.read(getWindowStart() / cache.getSlotLength(), slots.data(), numSlots);
+    
+    auto height = static_cast<float>(plotArea.getHeight());
+    auto top = static_cast<float>(plotArea.getY());
+    auto slotWidth = static_cast<float>(getWidth()) / numSlots;
+    
+    auto toY = [&](const juce::int16& value)
+    {
+        auto db = SessionTimeline::Record::toDb(value);
+        return top + juce::jmap<float>(juce::jlimit(Globals::negInf(), Globals::maxDb(), db),
+                                       Globals::negInf(), Globals::maxDb(), height, 0.f);
+    };
+    
+    if ( selectionEnd > selectionStart )
+    {
+        g.setColour(MyColours::getColour(MyColours::Text).withAlpha(0.1f));
+        g.fillRect(juce::Rectangle<float>(toX(selectionStart), top, toX(selectionEnd) - toX(selectionStart), height));
+    }
+    
+    juce::Path rmsPath, loudnessPath;
+    auto rmsPenDown = false;
+    auto loudnessPenDown = false;
+    
+    // unknown values break the line rather than dropping it to the floor
+    auto extend = [](juce::Path& path, bool& penDown, const float& x, const float& y)
+    {
+        if ( penDown )
+            path.lineTo(x, y);
+        else
+            path.startNewSubPath(x, y);
+        
+        penDown = true;
+    };
+    
+    for ( auto i = 0; i < numSlots; ++i )
+    {
+        const auto& slot = slots[static_cast<size_t>(i)];
+        auto x = i * slotWidth;
+        
+        if ( slot.peak[Main] == PlayPositionCache::unknown )
+        {
+            rmsPenDown = false;
+            loudnessPenDown = false;
+            continue;
+        }
+        
+        g.setColour(MyColours::getColour(MyColours::GoniometerPath));
+        g.fillRect(juce::Rectangle<float>(x, toY(slot.peak[Main]), slotWidth, top + height - toY(slot.peak[Main])));
+        
+        extend(rmsPath, rmsPenDown, x, toY(slot.rms[Main]));
+        
+        if ( slot.momentaryLufs == PlayPositionCache::unknown )
+            loudnessPenDown = false;
+        else
+            extend(loudnessPath, loudnessPenDown, x, toY(slot.momentaryLufs));
+    }
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.strokePath(rmsPath, juce::PathStrokeType(1.f));
+    
+    g.setColour(MyColours::getColour(MyColours::Yellow));
+    g.strokePath(loudnessPath, juce::PathStrokeType(1.5f));
+    
+    g.setColour(MyColours::getColour(MyColours::RedBright));
+    g.fillRect(juce::Rectangle<float>(toX(playPosition), top, 1.f, height));
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.drawText(getTimeText(getWindowStart()), labelArea, juce::Justification::centredLeft);
+    g.drawText("PLAY POSITION  peak / rms / momentary", labelArea, juce::Justification::centred);
+    g.drawText(getTimeText(getWindowStart() + getWindowLength()), labelArea, juce::Justification::centredRight);
+    
+    auto lufs = [](const float& value)
+    {
+        return value <= LoudnessAnalyzer::minLufs ? juce::String("-inf") : juce::String(value, 1);
+    };
+    
+    juce::String summary;
+    summary << (selectionEnd > selectionStart ? "SELECTION" : "ON SCREEN")
+            << "   I " << lufs(region.integratedLufs) << " LUFS"
+            << "   LRA " << juce::String(region.loudnessRange, 1) << " LU"
+            << "   max M " << lufs(region.maxMomentaryLufs)
+            << "   max S " << lufs(region.maxShortTermLufs)
+            << "   peak " << juce::String(region.peakDb, 1) << " dBFS"
+            << "   measured " << juce::roundToInt(region.coverage * 100.f) << "%";
+    
+    g.drawText(summary, summaryArea, juce::Justification::centred);
+}
+
+juce::int64 PlayPositionView::getWindowLength() const
+{
+    return numSlots * static_cast<juce::int64>(cache.getSlotLength());
+}
+
+juce::int64 PlayPositionView::getWindowStart() const
+{
+    auto slotLength = cache.getSlotLength();
+    auto start = playPosition - static_cast<juce::int64>(getWindowLength() * playHeadProportion);
+    
+    // on a slot boundary, so slots keep to the same pixels from one paint to the next
+    return juce::jmax(juce::int64(0), start - (start % slotLength));
+}
+
+juce::int64 PlayPositionView::toTimelineSample(const float& x) const
+{
+    auto proportion = juce::jlimit(0.f, 1.f, x / juce::jmax(1, getWidth()));
+    return getWindowStart() + static_cast<juce::int64>(proportion * getWindowLength());
+}
+
+float PlayPositionView::toX(const juce::int64& sample) const
+{
+    return static_cast<float>(sample - getWindowStart()) * getWidth() / static_cast<float>(getWindowLength());
+}
+
+juce::String PlayPositionView::getTimeText(const juce::int64& sample) const
+{
+    // slots are a frame long, so the sample rate is frameRateHz of them
+    auto seconds = sample / (cache.getSlotLength() * static_cast<double>(MeterBallistics::frameRateHz));
+    auto wholeSeconds = static_cast<int>(seconds);
+    
+    return juce::String(wholeSeconds / 60) + ":" + juce::String(wholeSeconds % 60).paddedLeft('0', 2)
+           + "." + juce::String(static_cast<int>((seconds - wholeSeconds) * 10.0));
+}
+
+void PlayPositionView::updateRegion()
+{
+    if ( selectionEnd > selectionStart )
+        region = cache.getRegion(selectionStart, selectionEnd);
+    else
+        region = cache.getRegion(getWindowStart(), getWindowStart() + getWindowLength());
+}
+
+void PlayPositionView::timerCallback()
+{
+    auto position = state.getLatestFrame().hostEndSample;
+    auto revision = cache.getRevision();
+    
+    // a stopped transport leaves the view where it was
+    if ( position < 0 || (position == playPosition && revision == lastRevision) )
+        return;
+    
+    playPosition = position;
+    lastRevision = revision;
+    
+    updateRegion();
+    repaint();
+}
+
+void PlayPositionView::visibilityChanged()
+{
+    // only poll while someone is looking
+    if ( isVisible() )
+    {
+        lastRevision = 0;
+        timerCallback();
+        startTimerHz(10);
+    }
+    else
+    {
+        stopTimer();
+    }
+}
+
+void PlayPositionView::mouseDown(const juce::MouseEvent& e)
+{
+    // the window moves on while playing, so the selection is held in timeline samples
+    dragAnchor = toTimelineSample(e.position.x);
+}
+
+void PlayPositionView::mouseDrag(const juce::MouseEvent& e)
+{
+    auto current = toTimelineSample(e.position.x);
+    
+    selectionStart = juce::jmin(dragAnchor, current);
+    selectionEnd = juce::jmax(dragAnchor, current);
+    
+    updateRegion();
+    repaint();
+}
+
+void PlayPositionView::mouseDoubleClick(const juce::MouseEvent&)
+{
+    selectionStart = 0;
+    selectionEnd = 0;
+    
+    updateRegion();
+    repaint();
+}
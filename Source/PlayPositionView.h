@@ -0,0 +1,73 @@
+/*
+  ==============================================================================
+
+    PlayPositionView.h
+    Created: 19 Oct 2026 5:38:20am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "AnalysisState.h"
+#include "PlayPositionCache.h"
+#include "SharedRenderResources.h"
+#include "MeterBallistics.h"
+
+//==============================================================================
+/*
+Hidden overlay showing the host timeline around the play head as it was last
+measured, ahead of the play head as well as behind it, so going round a loop
+shows the whole loop from the first pass on. Underneath, the integrated
+loudness, range and maxima of what's on screen, or of the stretch dragged
+across; a double click goes back to all of it. Stays where it was while the
+transport is stopped.
+*/
+struct PlayPositionView : juce::Component, juce::Timer
+{
+    PlayPositionView(PlayPositionCache& c, const AnalysisState& s) : cache(c), state(s) { }
+    
+    void paint(juce::Graphics& g) override;
+    void timerCallback() override;
+    void visibilityChanged() override;
+    
+    void mouseDown(const juce::MouseEvent& e) override;
+    void mouseDrag(const juce::MouseEvent& e) override;
+    void mouseDoubleClick(const juce::MouseEvent& e) override;
+    
+    static constexpr int windowSeconds = 20;
+    static constexpr int numSlots = windowSeconds * MeterBallistics::frameRateHz;
+    
+    // how much of the window is behind the play head
+    static constexpr float playHeadProportion = 0.75f;
+
+private:
+    juce::int64 getWindowStart() const;
+    juce::int64 getWindowLength() const;
+    juce::int64 toTimelineSample(const float& x) const;
+    float toX(const juce::int64& sample) const;
+    juce::String getTimeText(const juce::int64& sample) const;
+    
+    void updateRegion();
+    
+    PlayPositionCache& cache;
+    const AnalysisState& state;
+    
+    juce::int64 playPosition = -1;
+    juce::uint64 lastRevision = 0;
+    
+    // in timeline samples, end <= start when nothing is selected
+    juce::int64 selectionStart = 0;
+    juce::int64 selectionEnd = 0;
+    juce::int64 dragAnchor = 0;
+    
+    PlayPositionCache::Region region;
+    
+    // one per slot on screen, so paint() never allocates
+    std::vector<SessionTimeline::Record> slots = std::vector<SessionTimeline::Record>(numSlots);
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
@@ -1,287 +1,468 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin editor.
-
-  ==============================================================================
-*/
-
-#include "PluginProcessor.h"
-#include "PluginEditor.h"
-
-//==============================================================================
-PFMProject10AudioProcessorEditor::PFMProject10AudioProcessorEditor (PFMProject10AudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p), stereoImageMeter(p.getSampleRate(), p.getBlockSize())
-{
-    // Make sure that before the constructor has finished, you've set the
-    // editor's size to whatever you need it to be.
-    startTimerHz(40);
-    
-    addAndMakeVisible(stereoMeterRms);
-    addAndMakeVisible(stereoMeterPeak);
-    addAndMakeVisible(histograms);
-    addAndMakeVisible(stereoImageMeter);
-    addAndMakeVisible(holdResetBtns);
-    addAndMakeVisible(timeToggles);
-    addAndMakeVisible(gonioControl);
-    addAndMakeVisible(viewToggles);
-    
-    auto& state = audioProcessor.valueTree;
-    
-    // link widgets to valueTree
-    holdResetBtns.holdButton.getToggleStateValue().referTo(state.getPropertyAsValue("EnableHold", nullptr));
-    
-    timeToggles.decayRate.getValueObject().referTo(state.getPropertyAsValue("DecayTime", nullptr));
-    timeToggles.avgDuration.getValueObject().referTo(state.getPropertyAsValue("AverageTime", nullptr));
-    timeToggles.holdTime.getValueObject().referTo(state.getPropertyAsValue("HoldTime", nullptr));
-    
-    gonioControl.gonioScaleKnob.getValueObject().referTo(state.getPropertyAsValue("GoniometerScale", nullptr));
-    viewToggles.meterView.getValueObject().referTo(state.getPropertyAsValue("MeterViewMode", nullptr));
-    viewToggles.histView.getValueObject().referTo(state.getPropertyAsValue("HistogramView", nullptr));
-    
-    stereoMeterRms.threshCtrl.getValueObject().referTo(state.getPropertyAsValue("RMSThreshold", nullptr));
-    stereoMeterPeak.threshCtrl.getValueObject().referTo(state.getPropertyAsValue("PeakThreshold", nullptr));
-    
-    histograms.getThresholdValueObject(HistogramTypes::RMS).referTo(state.getPropertyAsValue("RMSThreshold", nullptr));
-    histograms.getThresholdValueObject(HistogramTypes::PEAK).referTo(state.getPropertyAsValue("PeakThreshold", nullptr));
-    
-    // set initial values
-    bool holdButtonState = state.getPropertyAsValue("EnableHold", nullptr).getValue();
-    stereoMeterRms.setTickVisibility(holdButtonState);
-    stereoMeterPeak.setTickVisibility(holdButtonState);
-    
-    updateParams(ToggleGroup::DecayRate, state.getPropertyAsValue("DecayTime", nullptr).getValue());
-    timeToggles.decayRate.setSelectedToggleFromState();
-    
-    updateParams(ToggleGroup::AverageTime, state.getPropertyAsValue("AverageTime", nullptr).getValue());
-    timeToggles.avgDuration.setSelectedToggleFromState();
-    
-    updateParams(ToggleGroup::HoldTime, state.getPropertyAsValue("HoldTime", nullptr).getValue());
-    timeToggles.holdTime.setSelectedToggleFromState();
-    
-    double gonioScale = state.getPropertyAsValue("GoniometerScale", nullptr).getValue();
-    stereoImageMeter.setGoniometerScale(gonioScale);
-    
-    updateParams(ToggleGroup::MeterView, state.getPropertyAsValue("MeterViewMode", nullptr).getValue());
-    viewToggles.meterView.setSelectedToggleFromState();
-    
-    updateParams(ToggleGroup::HistView, state.getPropertyAsValue("HistogramView", nullptr).getValue());
-    viewToggles.histView.setSelectedToggleFromState();
-    
-    float rmsThresh = state.getPropertyAsValue("RMSThreshold", nullptr).getValue();
-    stereoMeterRms.setThreshold(rmsThresh);
-    histograms.setThreshold(HistogramTypes::RMS, rmsThresh);
-    
-    float peakThresh = state.getPropertyAsValue("PeakThreshold", nullptr).getValue();
-    stereoMeterPeak.setThreshold(peakThresh);
-    histograms.setThreshold(HistogramTypes::PEAK, peakThresh);
-    
-    // handle change events
-    stereoMeterRms.threshCtrl.onValueChange = [this]
-    {
-        stereoMeterRms.setThreshold(stereoMeterRms.threshCtrl.getValue());
-    };
-    
-    stereoMeterPeak.threshCtrl.onValueChange = [this]
-    {
-        stereoMeterPeak.setThreshold(stereoMeterPeak.threshCtrl.getValue());
-    };
-    
-    holdResetBtns.holdButton.onClick = [this]
-    {
-        auto toggleState = holdResetBtns.holdButton.getToggleState();
-        stereoMeterRms.setTickVisibility(toggleState);
-        stereoMeterPeak.setTickVisibility(toggleState);
-        
-        auto resetIsVisible = holdResetBtns.resetButton.isVisible();
-        auto holdTimeId = timeToggles.holdTime.getValueObject().getValue();
-        if ( !toggleState && resetIsVisible )
-        {
-            holdResetBtns.resetButton.setVisible(false);
-        }
-        else if ( toggleState && static_cast<int>(holdTimeId) == 6 && !resetIsVisible )
-        {
-            holdResetBtns.resetButton.setVisible(true);
-        }
-    };
-    
-    holdResetBtns.resetButton.onClick = [this]
-    {
-        stereoMeterRms.resetValueHolder();
-        stereoMeterPeak.resetValueHolder();
-        holdResetBtns.resetButton.animateButton();
-    };
-    
-    gonioControl.gonioScaleKnob.onValueChange = [this]
-    {
-        auto rotaryValue = gonioControl.gonioScaleKnob.getValue();
-        stereoImageMeter.setGoniometerScale(rotaryValue);
-    };
-    
-    initToggleGroupCallbacks(ToggleGroup::DecayRate,   timeToggles.decayRate.toggles);
-    initToggleGroupCallbacks(ToggleGroup::AverageTime, timeToggles.avgDuration.toggles);
-    initToggleGroupCallbacks(ToggleGroup::HoldTime,    timeToggles.holdTime.toggles);
-    initToggleGroupCallbacks(ToggleGroup::MeterView,   viewToggles.meterView.toggles);
-    initToggleGroupCallbacks(ToggleGroup::HistView,    viewToggles.histView.toggles);
-    
-#if defined(GAIN_TEST_ACTIVE)
-    addAndMakeVisible(gainSlider);
-    gainSlider.setSliderStyle(juce::Slider::SliderStyle::LinearVertical);
-#endif
-
-    setSize (800, 600);
-}
-
-PFMProject10AudioProcessorEditor::~PFMProject10AudioProcessorEditor()
-{
-    stopTimer();
-}
-
-//==============================================================================
-void PFMProject10AudioProcessorEditor::paint (juce::Graphics& g)
-{
-    g.fillAll(MyColours::getColour(MyColours::Background));
-}
-
-void PFMProject10AudioProcessorEditor::resized()
-{
-    // This is generally where you'll want to lay out the positions of any
-    // subcomponents in your editor..
-    auto bounds = getLocalBounds();
-    auto width = bounds.getWidth();
-    auto padding = 10;
-    auto stereoMeterWidth = 90;
-    auto stereoMeterHeight = 350;
-    
-    // setBounds args (int x, int y, int width, int height)
-    stereoMeterRms.setBounds(padding,
-                             padding,
-                             stereoMeterWidth,
-                             stereoMeterHeight);
-    
-    stereoMeterPeak.setBounds(width - (stereoMeterWidth + padding),
-                              padding,
-                              stereoMeterWidth,
-                              stereoMeterHeight);
-    
-    histograms.setBounds(padding,
-                         stereoMeterRms.getBottom() + (padding * 2),
-                         width - (padding * 2),
-                         210);
-    
-    auto stereoImageMeterWidth = 280; // this will also be the height of the goniometer
-    auto stereoImageMeterHeight = 300;
-    
-    stereoImageMeter.setBounds(bounds.getCentreX() - (stereoImageMeterWidth / 2),
-                              (histograms.getY() / 2) - (stereoImageMeterHeight / 2),
-                              stereoImageMeterWidth,
-                              stereoImageMeterHeight);
-    
-    auto comboWidth = stereoImageMeter.getX() - stereoMeterRms.getRight() - (padding * 4);
-    
-    auto toggleContainerHeight = 300;
-    timeToggles.setBounds(stereoMeterRms.getRight() + (padding * 2),
-                          stereoImageMeter.getBottom() - toggleContainerHeight,
-                          comboWidth,
-                          toggleContainerHeight);
-    
-    auto btnHeight = timeToggles.getY() - (padding * 2);
-    holdResetBtns.setBounds(timeToggles.getX(),
-                            timeToggles.getY() - btnHeight,
-                            comboWidth,
-                            btnHeight);
-    
-    gonioControl.setBounds(stereoMeterPeak.getX() - (padding * 2) - comboWidth,
-                           padding,
-                           comboWidth,
-                           120);
-    
-    viewToggles.setBounds(stereoMeterPeak.getX() - (padding * 2) - comboWidth,
-                           stereoImageMeter.getBottom() - 135,
-                           comboWidth,
-                           135);
-    
-#if defined(GAIN_TEST_ACTIVE)
-    gainSlider.setBounds(stereoMeterRms.getRight(), padding * 2, 20, 320);
-#endif
-}
-
-void PFMProject10AudioProcessorEditor::timerCallback()
-{
-    if ( audioProcessor.fifo.getNumAvailable() > 0 )
-    {
-        while ( audioProcessor.fifo.pull(incomingBuffer) )
-        {
-            // do nothing else - just looping through until incomingBuffer = most recent available buffer
-        }
-        
-        auto numSamples = incomingBuffer.getNumSamples();
-                
-        auto rmsL = incomingBuffer.getRMSLevel(0, 0, numSamples);
-        auto rmsR = incomingBuffer.getRMSLevel(1, 0, numSamples);
-        auto rmsDbL = juce::Decibels::gainToDecibels(rmsL, Globals::negInf());
-        auto rmsDbR = juce::Decibels::gainToDecibels(rmsR, Globals::negInf());
-        stereoMeterRms.update(rmsDbL, rmsDbR);
-        
-        auto peakL = incomingBuffer.getMagnitude(0, 0, numSamples);
-        auto peakR = incomingBuffer.getMagnitude(1, 0, numSamples);
-        auto peakDbL = juce::Decibels::gainToDecibels(peakL, Globals::negInf());
-        auto peakDbR = juce::Decibels::gainToDecibels(peakR, Globals::negInf());
-        stereoMeterPeak.update(peakDbL, peakDbR);
-        
-        histograms.update(HistogramTypes::RMS, rmsDbL, rmsDbR);
-        histograms.update(HistogramTypes::PEAK, peakDbL, peakDbR);
-        
-        stereoImageMeter.update(incomingBuffer);
-    }
-}
-
-void PFMProject10AudioProcessorEditor::initToggleGroupCallbacks(const ToggleGroup& toggleGroup, const std::vector<CustomToggle*>& togglePtrs)
-{
-    for ( size_t i = 0; i < togglePtrs.size(); ++i )
-    {
-        togglePtrs[i]->onClick = [i, this, toggleGroup] { updateParams(toggleGroup, i+1); };
-    }
-}
-
-void PFMProject10AudioProcessorEditor::updateParams(const ToggleGroup& toggleGroup, const int& selectedId)
-{
-    switch (toggleGroup)
-    {
-        case ToggleGroup::DecayRate:
-        {
-            stereoMeterRms.setDecayRate(selectedId);
-            stereoMeterPeak.setDecayRate(selectedId);
-            timeToggles.decayRate.setSelectedValue(selectedId);
-            break;
-        }
-        case ToggleGroup::AverageTime:
-        {
-            stereoMeterRms.resizeAverager(selectedId);
-            stereoMeterPeak.resizeAverager(selectedId);
-            timeToggles.avgDuration.setSelectedValue(selectedId);
-            break;
-        }
-        case ToggleGroup::MeterView:
-        {
-            stereoMeterRms.setMeterView(selectedId);
-            stereoMeterPeak.setMeterView(selectedId);
-            viewToggles.meterView.setSelectedValue(selectedId);
-            break;
-        }
-        case ToggleGroup::HoldTime:
-        {
-            stereoMeterRms.setTickHoldTime(selectedId);
-            stereoMeterPeak.setTickHoldTime(selectedId);
-            timeToggles.holdTime.setSelectedValue(selectedId);
-            holdResetBtns.resetButton.setVisible( (selectedId == 6 && holdResetBtns.holdButton.getToggleState()) );
-            break;
-        }
-        case ToggleGroup::HistView:
-        {
-            histograms.setView(selectedId);
-            viewToggles.histView.setSelectedValue(selectedId);
-            break;
-        }
-    }
-}
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin editor.
+
+  ==============================================================================
+*/
+
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+//==============================================================================
+PFMProject10AudioProcessorEditor::PFMProject10AudioProcessorEditor (PFMProject10AudioProcessor& p)
+    : AudioProcessorEditor (&p), audioProcessor (p), analysisState (p.analysisState), analyzer (p.analysisState.meters)
+{
+    // Make sure that before the constructor has finished, you've set the
+    // editor's size to whatever you need it to be.
+    startTimerHz(MeterBallistics::frameRateHz);
+    
+    audioProcessor.startFollowers();
+    
+    addAndMakeVisible(stereoMeterRms);
+    addAndMakeVisible(stereoMeterPeak);
+    addAndMakeVisible(histograms);
+    addAndMakeVisible(stereoImageMeter);
+    addAndMakeVisible(holdResetBtns);
+    addAndMakeVisible(timeToggles);
+    addAndMakeVisible(gonioControl);
+    addAndMakeVisible(viewToggles);
+    
+    auto& state = audioProcessor.valueTree;
+    
+    // link widgets to valueTree
+    holdResetBtns.holdButton.getToggleStateValue().referTo(state.getPropertyAsValue("EnableHold", nullptr));
+    
+    timeToggles.decayRate.getValueObject().referTo(state.getPropertyAsValue("DecayTime", nullptr));
+    timeToggles.avgDuration.getValueObject().referTo(state.getPropertyAsValue("AverageTime", nullptr));
+    timeToggles.holdTime.getValueObject().referTo(state.getPropertyAsValue("HoldTime", nullptr));
+    
+    gonioControl.gonioScaleKnob.getValueObject().referTo(state.getPropertyAsValue("GoniometerScale", nullptr));
+    viewToggles.meterView.getValueObject().referTo(state.getPropertyAsValue("MeterViewMode", nullptr));
+    viewToggles.histView.getValueObject().referTo(state.getPropertyAsValue("HistogramView", nullptr));
+    
+    stereoMeterRms.threshCtrl.getValueObject().referTo(state.getPropertyAsValue("RMSThreshold", nullptr));
+    stereoMeterPeak.threshCtrl.getValueObject().referTo(state.getPropertyAsValue("PeakThreshold", nullptr));
+    
+    histograms.getThresholdValueObject(HistogramTypes::RMS).referTo(state.getPropertyAsValue("RMSThreshold", nullptr));
+    histograms.getThresholdValueObject(HistogramTypes::PEAK).referTo(state.getPropertyAsValue("PeakThreshold", nullptr));
+    
+    // set initial values
+    bool holdButtonState = state.getPropertyAsValue("EnableHold", nullptr).getValue();
+    stereoMeterRms.setTickVisibility(holdButtonState);
+    stereoMeterPeak.setTickVisibility(holdButtonState);
+    
+    updateParams(ToggleGroup::DecayRate, state.getPropertyAsValue("DecayTime", nullptr).getValue());
+    timeToggles.decayRate.setSelectedToggleFromState();
+    
+    updateParams(ToggleGroup::AverageTime, state.getPropertyAsValue("AverageTime", nullptr).getValue());
+    timeToggles.avgDuration.setSelectedToggleFromState();
+    
+    updateParams(ToggleGroup::HoldTime, state.getPropertyAsValue("HoldTime", nullptr).getValue());
+    timeToggles.holdTime.setSelectedToggleFromState();
+    
+    double gonioScale = state.getPropertyAsValue("GoniometerScale", nullptr).getValue();
+    stereoImageMeter.setGoniometerScale(gonioScale);
+    
+    updateParams(ToggleGroup::MeterView, state.getPropertyAsValue("MeterViewMode", nullptr).getValue());
+    viewToggles.meterView.setSelectedToggleFromState();
+    
+    updateParams(ToggleGroup::HistView, state.getPropertyAsValue("HistogramView", nullptr).getValue());
+    viewToggles.histView.setSelectedToggleFromState();
+    
+    float rmsThresh = state.getPropertyAsValue("RMSThreshold", nullptr).getValue();
+    stereoMeterRms.setThreshold(rmsThresh);
+    analyzer.setRmsThreshold(rmsThresh);
+    histograms.setThreshold(HistogramTypes::RMS, rmsThresh);
+    
+    float peakThresh = state.getPropertyAsValue("PeakThreshold", nullptr).getValue();
+    stereoMeterPeak.setThreshold(peakThresh);
+    analyzer.setPeakThreshold(peakThresh);
+    histograms.setThreshold(HistogramTypes::PEAK, peakThresh);
+    
+    // handle change events
+    stereoMeterRms.threshCtrl.onValueChange = [this]
+    {
+        auto threshold = static_cast<float>(stereoMeterRms.threshCtrl.getValue());
+        stereoMeterRms.setThreshold(threshold);
+        analyzer.setRmsThreshold(threshold);
+        audioProcessor.setRmsThreshold(threshold);
+    };
+    
+    stereoMeterPeak.threshCtrl.onValueChange = [this]
+    {
+        auto threshold = static_cast<float>(stereoMeterPeak.threshCtrl.getValue());
+        stereoMeterPeak.setThreshold(threshold);
+        analyzer.setPeakThreshold(threshold);
+        audioProcessor.setPeakThreshold(threshold);
+    };
+    
+    holdResetBtns.holdButton.onClick = [this]
+    {
+        auto toggleState = holdResetBtns.holdButton.getToggleState();
+        stereoMeterRms.setTickVisibility(toggleState);
+        stereoMeterPeak.setTickVisibility(toggleState);
+        
+        auto resetIsVisible = holdResetBtns.resetButton.isVisible();
+        auto holdTimeId = timeToggles.holdTime.getValueObject().getValue();
+        if ( !toggleState && resetIsVisible )
+        {
+            holdResetBtns.resetButton.setVisible(false);
+        }
+        else if ( toggleState && static_cast<int>(holdTimeId) == 6 && !resetIsVisible )
+        {
+            holdResetBtns.resetButton.setVisible(true);
+        }
+    };
+    
+    holdResetBtns.resetButton.onClick = [this]
+    {
+        analyzer.resetTicks();
+        holdResetBtns.resetButton.animateButton();
+    };
+    
+    gonioControl.gonioScaleKnob.onValueChange = [this]
+    {
+        auto rotaryValue = gonioControl.gonioScaleKnob.getValue();
+        stereoImageMeter.setGoniometerScale(rotaryValue);
+    };
+    
+    initToggleGroupCallbacks(ToggleGroup::DecayRate,   timeToggles.decayRate.toggles);
+    initToggleGroupCallbacks(ToggleGroup::AverageTime, timeToggles.avgDuration.toggles);
+    initToggleGroupCallbacks(ToggleGroup::HoldTime,    timeToggles.holdTime.toggles);
+    initToggleGroupCallbacks(ToggleGroup::MeterView,   viewToggles.meterView.toggles);
+    initToggleGroupCallbacks(ToggleGroup::HistView,    viewToggles.histView.toggles);
+    
+    addChildComponent(profilerOverlay);
+    addChildComponent(timelineView);
+    addChildComponent(overLog);
+    addChildComponent(positionView);
+    setWantsKeyboardFocus(true);
+    
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+    addChildComponent(diagnosticsPanel);
+#endif
+    
+    setChannelLayout(getMainBusLayout(audioProcessor));
+    
+    // catch up with everything measured while the editor was closed before the first paint
+    timerCallback();
+}
+
+PFMProject10AudioProcessorEditor::~PFMProject10AudioProcessorEditor()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void PFMProject10AudioProcessorEditor::paint (juce::Graphics& g)
+{
+    g.fillAll(MyColours::getColour(MyColours::Background));
+    
+    if ( tracer->isRecording() )
+    {
+        g.setColour(MyColours::getColour(MyColours::RedBright));
+        g.drawText("TRACING", getLocalBounds().removeFromBottom(14).reduced(10, 0), juce::Justification::centredRight);
+    }
+    
+    if ( audioProcessor.overCapture.isCapturing() )
+    {
+        g.setColour(MyColours::getColour(MyColours::RedBright));
+        g.drawText("CAPTURING OVERS", getLocalBounds().removeFromBottom(14), juce::Justification::centred);
+    }
+    
+    // the meters are showing the generator, not the input, so make that hard to miss
+    auto testSignal = audioProcessor.testSignal.getType();
+    
+    if ( testSignal != SignalGenerator::Off )
+    {
+        g.setColour(MyColours::getColour(MyColours::RedBright));
+        g.drawText(juce::String("TEST SIGNAL: ") + SignalGenerator::getTypeName(testSignal),
+                   getLocalBounds().removeFromBottom(14).reduced(10, 0),
+                   juce::Justification::centredLeft);
+    }
+}
+
+void PFMProject10AudioProcessorEditor::resized()
+{
+    // This is generally where you'll want to lay out the positions of any
+    // subcomponents in your editor..
+    auto bounds = getLocalBounds();
+    auto width = bounds.getWidth();
+    auto padding = 10;
+    auto stereoMeterWidth = StereoMeter::getPreferredWidth(analyzer.getNumChannels());
+    auto stereoMeterHeight = 350;
+    
+    // setBounds args (int x, int y, int width, int height)
+    stereoMeterRms.setBounds(padding,
+                             padding,
+                             stereoMeterWidth,
+                             stereoMeterHeight);
+    
+    stereoMeterPeak.setBounds(width - (stereoMeterWidth + padding),
+                              padding,
+                              stereoMeterWidth,
+                              stereoMeterHeight);
+    
+    histograms.setBounds(padding,
+                         stereoMeterRms.getBottom() + (padding * 2),
+                         width - (padding * 2),
+                         210);
+    
+    auto stereoImageMeterWidth = 280; // this will also be the height of the goniometer
+    auto stereoImageMeterHeight = 300;
+    
+    stereoImageMeter.setBounds(bounds.getCentreX() - (stereoImageMeterWidth / 2),
+                              (histograms.getY() / 2) - (stereoImageMeterHeight / 2),
+                              stereoImageMeterWidth,
+                              stereoImageMeterHeight);
+    
+    auto comboWidth = stereoImageMeter.getX() - stereoMeterRms.getRight() - (padding * 4);
+    
+    auto toggleContainerHeight = 300;
+    timeToggles.setBounds(stereoMeterRms.getRight() + (padding * 2),
+                          stereoImageMeter.getBottom() - toggleContainerHeight,
+                          comboWidth,
+                          toggleContainerHeight);
+    
+    auto btnHeight = timeToggles.getY() - (padding * 2);
+    holdResetBtns.setBounds(timeToggles.getX(),
+                            timeToggles.getY() - btnHeight,
+                            comboWidth,
+                            btnHeight);
+    
+    gonioControl.setBounds(stereoMeterPeak.getX() - (padding * 2) - comboWidth,
+                           padding,
+                           comboWidth,
+                           120);
+    
+    viewToggles.setBounds(stereoMeterPeak.getX() - (padding * 2) - comboWidth,
+                           stereoImageMeter.getBottom() - 135,
+                           comboWidth,
+                           135);
+    
+    profilerOverlay.setBounds(stereoImageMeter.getBounds());
+    timelineView.setBounds(histograms.getBounds());
+    overLog.setBounds(histograms.getBounds());
+    positionView.setBounds(histograms.getBounds());
+    
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+    diagnosticsPanel.setBounds(histograms.getBounds());
+#endif
+}
+
+void PFMProject10AudioProcessorEditor::timerCallback()
+{
+    profiler.markTimerTick();
+    ScopedFrameTimer frameTimer(profiler, FrameProfiler::TimerCallback);
+    
+    auto now = juce::Time::currentTimeMillis();
+    auto layout = getMainBusLayout(audioProcessor);
+    
+    if ( layout != channelLayout )
+        setChannelLayout(layout);
+    
+    // levels and correlation are measured on the audio thread, one frame every 25ms
+    auto hasNewFrames = false;
+    {
+        ScopedFrameTimer updateTimer(profiler, FrameProfiler::AnalysisUpdate);
+        hasNewFrames = analysisState.update(now);
+    }
+    
+    if ( hasNewFrames )
+    {
+        histograms.refresh();
+        stereoImageMeter.update(analysisState.getLatestFrame());
+    }
+    
+    if ( audioProcessor.fifo.getNumAvailable() > 0 )
+    {
+        while ( audioProcessor.fifo.pull(incomingBuffer) )
+        {
+            // do nothing else - just looping through until incomingBuffer = most recent available buffer
+        }
+        
+        stereoImageMeter.update(incomingBuffer);
+    }
+    
+    stereoMeterRms.update(analyzer.rms, analyzer.hasReference() ? &analyzer.referenceRms : nullptr);
+    stereoMeterPeak.update(analyzer.peak, analyzer.hasReference() ? &analyzer.referencePeak : nullptr);
+    
+    overLog.pullEvents();
+}
+
+bool PFMProject10AudioProcessorEditor::keyPressed(const juce::KeyPress& key)
+{
+    auto modifiers = juce::ModifierKeys::commandModifier | juce::ModifierKeys::shiftModifier;
+    
+    if ( key == juce::KeyPress('p', modifiers, 0) )
+    {
+        profilerOverlay.setVisible( !profilerOverlay.isVisible() );
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('t', modifiers, 0) )
+    {
+        toggleTracing();
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('g', modifiers, 0) )
+    {
+        cycleTestSignal();
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('o', modifiers, 0) )
+    {
+        toggleOverCapture();
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('s', modifiers, 0) )
+    {
+        toggleTimeline();
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('l', modifiers, 0) )
+    {
+        timelineView.setVisible( !timelineView.isVisible() );
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('e', modifiers, 0) )
+    {
+        overLog.setVisible( !overLog.isVisible() );
+        return true;
+    }
+    
+    if ( key == juce::KeyPress('r', modifiers, 0) )
+    {
+        positionView.setVisible( !positionView.isVisible() );
+        return true;
+    }
+    
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+    if ( key == juce::KeyPress('d', modifiers, 0) )
+    {
+        diagnosticsPanel.setVisible( !diagnosticsPanel.isVisible() );
+        return true;
+    }
+#endif
+    
+    return false;
+}
+
+void PFMProject10AudioProcessorEditor::initToggleGroupCallbacks(const ToggleGroup& toggleGroup, const std::vector<CustomToggle*>& togglePtrs)
+{
+    for ( size_t i = 0; i < togglePtrs.size(); ++i )
+    {
+        togglePtrs[i]->onClick = [i, this, toggleGroup] { updateParams(toggleGroup, i+1); };
+    }
+}
+
+void PFMProject10AudioProcessorEditor::updateParams(const ToggleGroup& toggleGroup, const int& selectedId)
+{
+    switch (toggleGroup)
+    {
+        case ToggleGroup::DecayRate:
+        {
+            analyzer.setDecayRate(selectedId);
+            timeToggles.decayRate.setSelectedValue(selectedId);
+            break;
+        }
+        case ToggleGroup::AverageTime:
+        {
+            analyzer.resizeAverager(selectedId);
+            timeToggles.avgDuration.setSelectedValue(selectedId);
+            break;
+        }
+        case ToggleGroup::MeterView:
+        {
+            stereoMeterRms.setMeterView(selectedId);
+            stereoMeterPeak.setMeterView(selectedId);
+            viewToggles.meterView.setSelectedValue(selectedId);
+            break;
+        }
+        case ToggleGroup::HoldTime:
+        {
+            analyzer.setTickHoldTime(selectedId);
+            timeToggles.holdTime.setSelectedValue(selectedId);
+            holdResetBtns.resetButton.setVisible( (selectedId == 6 && holdResetBtns.holdButton.getToggleState()) );
+            break;
+        }
+        case ToggleGroup::HistView:
+        {
+            histograms.setView(selectedId);
+            viewToggles.histView.setSelectedValue(selectedId);
+            break;
+        }
+    }
+}
+
+void PFMProject10AudioProcessorEditor::setChannelLayout(const juce::AudioChannelSet& layout)
+{
+    channelLayout = layout;
+    
+    analyzer.setNumChannels(layout.size());
+    stereoMeterRms.setChannelLayout(layout);
+    stereoMeterPeak.setChannelLayout(layout);
+    
+    // layouts wider than stereo widen the editor, the centre section keeps its size
+    auto extraWidth = StereoMeter::getPreferredWidth(analyzer.getNumChannels()) - StereoMeter::getPreferredWidth(2);
+    setSize(800 + (extraWidth * 2), 600);
+}
+
+juce::AudioChannelSet PFMProject10AudioProcessorEditor::getMainBusLayout(const PFMProject10AudioProcessor& processor)
+{
+    auto layout = processor.getChannelLayoutOfBus(false, 0);
+    return layout.size() > 0 ? layout : juce::AudioChannelSet::stereo();
+}
+
+void PFMProject10AudioProcessorEditor::cycleTestSignal()
+{
+    auto& generator = audioProcessor.testSignal;
+    auto next = (static_cast<int>(generator.getType()) + 1) % SignalGenerator::NumTypes;
+    
+    generator.setType(static_cast<SignalGenerator::Type>(next));
+    repaint();
+}
+
+void PFMProject10AudioProcessorEditor::toggleTracing()
+{
+    if ( tracer->isRecording() )
+    {
+        tracer->stopRecording();
+        tracer->getDestination().revealToUser();
+    }
+    else
+    {
+        auto folder = juce::File::getSpecialLocation(juce::File::userDocumentsDirectory).getChildFile("PFMProject10 Traces");
+        folder.createDirectory();
+        
+        auto name = "trace " + juce::Time::getCurrentTime().formatted("%Y-%m-%d %H-%M-%S") + ".json";
+        tracer->startRecording(folder.getChildFile(name));
+    }
+    
+    repaint();
+}
+
+void PFMProject10AudioProcessorEditor::toggleOverCapture()
+{
+    auto& capture = audioProcessor.overCapture;
+    capture.setCapturing( !capture.isCapturing() );
+    
+    if ( !capture.isCapturing() && capture.getNumCaptured() > 0 )
+        OverCapture::getDirectory().revealToUser();
+    
+    repaint();
+}
+
+void PFMProject10AudioProcessorEditor::toggleTimeline()
+{
+    auto& timeline = audioProcessor.timeline;
+    timeline.setRecording( !timeline.isRecording() );
+    
+    timelineView.repaint();
+}
@@ -1,69 +1,117 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin editor.
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "PluginProcessor.h"
-
-#include "Globals.h"
-#include "StereoMeter.h"
-#include "HistogramContainer.h"
-#include "StereoImageMeter.h"
-#include "HoldResetButtons.h"
-#include "TimeControls.h"
-#include "GonioScaleControl.h"
-#include "ViewControls.h"
-#include "ToggleGroup.h"
-
-//==============================================================================
-/**
-*/
-class PFMProject10AudioProcessorEditor  : public juce::AudioProcessorEditor, juce::Timer
-{
-public:
-    PFMProject10AudioProcessorEditor (PFMProject10AudioProcessor&);
-    ~PFMProject10AudioProcessorEditor() override;
-
-    //==============================================================================
-    void paint (juce::Graphics&) override;
-    void resized() override;
-    
-    void timerCallback() override;
-    
-private:
-    // This reference is provided as a quick way for your editor to
-    // access the processor object that created it.
-    PFMProject10AudioProcessor& audioProcessor;
-    
-    juce::AudioBuffer<float> incomingBuffer;
-        
-    StereoMeter stereoMeterRms{"RMS"};
-    StereoMeter stereoMeterPeak{"PEAK"};
-    
-    HistogramContainer histograms;
-    
-    StereoImageMeter stereoImageMeter;
-    
-    HoldResetButtons holdResetBtns;
-    TimeControls timeToggles;
-    
-    GonioScaleControl gonioControl;
-    ViewControls viewToggles;
-    
-    void initToggleGroupCallbacks(const ToggleGroup& toggleGroup, const std::vector<CustomToggle*>& togglePtrs);
-    
-    void updateParams(const ToggleGroup& toggleGroup, const int& selectedId);
-    
-#if defined(GAIN_TEST_ACTIVE)
-    juce::Slider gainSlider;
-    juce::AudioProcessorValueTreeState::SliderAttachment gainAttachment{audioProcessor.apvts, "Gain", gainSlider};
-#endif
-    
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PFMProject10AudioProcessorEditor)
-};
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin editor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+#include "Globals.h"
+#include "StereoMeter.h"
+#include "AnalysisState.h"
+#include "HistogramContainer.h"
+#include "StereoImageMeter.h"
+#include "HoldResetButtons.h"
+#include "TimeControls.h"
+#include "GonioScaleControl.h"
+#include "ViewControls.h"
+#include "ToggleGroup.h"
+#include "DiagnosticsPanel.h"
+#include "FrameProfilerOverlay.h"
+#include "SessionTimelineView.h"
+#include "OverEventLog.h"
+#include "PlayPositionView.h"
+
+//==============================================================================
+/**
+*/
+class PFMProject10AudioProcessorEditor  : public juce::AudioProcessorEditor, juce::Timer
+{
+public:
+    PFMProject10AudioProcessorEditor (PFMProject10AudioProcessor&);
+    ~PFMProject10AudioProcessorEditor() override;
+
+    //==============================================================================
+    void paint (juce::Graphics&) override;
+    void resized() override;
+    
+    void timerCallback() override;
+    
+    bool keyPressed(const juce::KeyPress& key) override;
+    
+    FrameProfiler& getProfiler() { return profiler; }
+    
+private:
+    // This reference is provided as a quick way for your editor to
+    // access the processor object that created it.
+    PFMProject10AudioProcessor& audioProcessor;
+    
+    // the processor keeps measuring for as long as this editor is open
+    AnalysisState::Subscription subscription { audioProcessor.analysisState };
+    AnalysisState& analysisState;
+    MeterAnalyzer& analyzer;
+    
+    juce::AudioBuffer<float> incomingBuffer;
+    
+    juce::AudioChannelSet channelLayout;
+        
+    // this editor's timings, the views below record into it
+    FrameProfiler profiler;
+    
+    StereoMeter stereoMeterRms{"RMS", profiler};
+    StereoMeter stereoMeterPeak{"PEAK", profiler};
+    
+    HistogramContainer histograms { analysisState, profiler };
+    
+    StereoImageMeter stereoImageMeter { profiler };
+    
+    HoldResetButtons holdResetBtns;
+    TimeControls timeToggles;
+    
+    GonioScaleControl gonioControl;
+    ViewControls viewToggles;
+    
+    void initToggleGroupCallbacks(const ToggleGroup& toggleGroup, const std::vector<CustomToggle*>& togglePtrs);
+    
+    void updateParams(const ToggleGroup& toggleGroup, const int& selectedId);
+    
+    void setChannelLayout(const juce::AudioChannelSet& layout);
+    void toggleTracing();
+    
+    // cmd/ctrl + shift + O starts and stops saving the audio around overs
+    void toggleOverCapture();
+    
+    // cmd/ctrl + shift + S starts and stops recording the session timeline
+    void toggleTimeline();
+    
+    // cmd/ctrl + shift + G steps through the test signals
+    void cycleTestSignal();
+    
+    static juce::AudioChannelSet getMainBusLayout(const PFMProject10AudioProcessor& processor);
+    
+    // cmd/ctrl + shift + P
+    FrameProfilerOverlay profilerOverlay { profiler, MeterBallistics::frameRateHz };
+    
+    // cmd/ctrl + shift + L, over the histograms
+    SessionTimelineView timelineView { audioProcessor.timeline };
+    
+    // cmd/ctrl + shift + E, over the histograms
+    OverEventLog overLog { audioProcessor.overs };
+    
+    // cmd/ctrl + shift + R, over the histograms
+    PlayPositionView positionView { audioProcessor.positionCache, analysisState };
+    
+    // cmd/ctrl + shift + T starts and stops a trace capture
+    juce::SharedResourcePointer<TraceRecorder> tracer;
+    
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+    DiagnosticsPanel diagnosticsPanel { audioProcessor.diagnostics };
+#endif
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PFMProject10AudioProcessorEditor)
+};
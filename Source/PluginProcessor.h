@@ -1,123 +1,114 @@
-/*
-  ==============================================================================
-
-    This file contains the basic framework code for a JUCE plugin processor.
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include <array>
-
-//#define GAIN_TEST_ACTIVE
-
-//==============================================================================
-template<typename T>
-struct Fifo
-{
-    void prepare(int numSamples, int numChannels)
-    {
-        for ( auto& buffer : buffers)
-        {
-            buffer.setSize(numChannels, numSamples, false, true, true);
-            buffer.clear();
-        }
-    }
-    
-    bool push(const T& t)
-    {
-        auto write = fifo.write(1);
-        if ( write.blockSize1 > 0 )
-        {
-            buffers[write.startIndex1] = t;
-            return true;
-        }
-        return false;
-    }
-    
-    bool pull(T& t)
-    {
-        auto read = fifo.read(1);
-        if ( read.blockSize1 > 0 )
-        {
-            t = buffers[read.startIndex1];
-            return true;
-        }
-        return false;
-    }
-    
-    int getNumAvailable() const
-    {
-        return fifo.getNumReady();
-    }
-    
-private:
-    static constexpr int Capacity = 10;
-    std::array<T, Capacity> buffers;
-    juce::AbstractFifo fifo{Capacity};
-};
-
-//==============================================================================
-/**
-*/
-class PFMProject10AudioProcessor  : public juce::AudioProcessor
-{
-public:
-    //==============================================================================
-    PFMProject10AudioProcessor();
-    ~PFMProject10AudioProcessor() override;
-
-    //==============================================================================
-    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
-    void releaseResources() override;
-
-   #ifndef JucePlugin_PreferredChannelConfigurations
-    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
-   #endif
-
-    void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
-
-    //==============================================================================
-    juce::AudioProcessorEditor* createEditor() override;
-    bool hasEditor() const override;
-
-    //==============================================================================
-    const juce::String getName() const override;
-
-    bool acceptsMidi() const override;
-    bool producesMidi() const override;
-    bool isMidiEffect() const override;
-    double getTailLengthSeconds() const override;
-
-    //==============================================================================
-    int getNumPrograms() override;
-    int getCurrentProgram() override;
-    void setCurrentProgram (int index) override;
-    const juce::String getProgramName (int index) override;
-    void changeProgramName (int index, const juce::String& newName) override;
-
-    //==============================================================================
-    void getStateInformation (juce::MemoryBlock& destData) override;
-    void setStateInformation (const void* data, int sizeInBytes) override;
-    
-    Fifo<juce::AudioBuffer<float>> fifo;
-    
-    juce::ValueTree valueTree { "state" };
-    
-#if defined(GAIN_TEST_ACTIVE)
-    static juce::AudioProcessorValueTreeState::ParameterLayout getParameterLayout();
-    
-    juce::AudioProcessorValueTreeState apvts { *this, nullptr, "Parameters", getParameterLayout() };
-    
-    juce::dsp::Oscillator<float> sineOsc;
-
-    juce::dsp::Gain<float> gain;
-    juce::AudioParameterFloat* gainParam { nullptr };
-#endif
-
-private:
-    //==============================================================================
-    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PFMProject10AudioProcessor)
-};
+/*
+  ==============================================================================
+
+    This file contains the basic framework code for a JUCE plugin processor.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Fifo.h"
+#include "FrameAnalyzer.h"
+#include "AnalysisState.h"
+#include "RealtimeDiagnostics.h"
+#include "TraceRecorder.h"
+#include "SignalGenerator.h"
+#include "SessionTimeline.h"
+#include "OverCapture.h"
+#include "OverDetector.h"
+#include "PlayPositionCache.h"
+
+//==============================================================================
+/**
+*/
+class PFMProject10AudioProcessor  : public juce::AudioProcessor
+{
+public:
+    //==============================================================================
+    PFMProject10AudioProcessor();
+    ~PFMProject10AudioProcessor() override;
+
+    //==============================================================================
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override;
+    void releaseResources() override;
+
+   #ifndef JucePlugin_PreferredChannelConfigurations
+    bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
+   #endif
+
+    void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
+    //==============================================================================
+    juce::AudioProcessorEditor* createEditor() override;
+    bool hasEditor() const override;
+
+    //==============================================================================
+    const juce::String getName() const override;
+
+    bool acceptsMidi() const override;
+    bool producesMidi() const override;
+    bool isMidiEffect() const override;
+    double getTailLengthSeconds() const override;
+
+    //==============================================================================
+    int getNumPrograms() override;
+    int getCurrentProgram() override;
+    void setCurrentProgram (int index) override;
+    const juce::String getProgramName (int index) override;
+    void changeProgramName (int index, const juce::String& newName) override;
+
+    //==============================================================================
+    void getStateInformation (juce::MemoryBlock& destData) override;
+    void setStateInformation (const void* data, int sizeInBytes) override;
+    
+    // the goniometer only draws the first two channels of the latest block
+    static constexpr int goniometerSamples = 2048;
+    Fifo<juce::AudioBuffer<float>> fifo;
+    AnalysisState analysisState;
+    
+    // replaces the main bus input while a signal is selected, never saved with the state
+    SignalGenerator testSignal;
+    
+    // levels and loudness while turned on from the editor, kept on disk
+    SessionTimeline timeline { analysisState.history };
+    
+    // the last few seconds of the main bus, saved around overs while capturing
+    OverCapture overCapture { analysisState.history };
+    
+    // every over on the main bus, to the sample, with where the host timeline was
+    OverDetector overs;
+    
+    // levels and loudness by host timeline position, for loops and replays
+    PlayPositionCache positionCache { analysisState.history };
+    
+    // message thread. The level history follower and the position cache run
+    // from the first editor on, whenever the processor is prepared
+    void startFollowers();
+    
+    // the thresholds live in the value tree, which the audio thread can't read
+    void setRmsThreshold(const float& threshAsDecibels);
+    void setPeakThreshold(const float& threshAsDecibels);
+    
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+    RealtimeDiagnostics diagnostics;
+#endif
+    
+    juce::ValueTree valueTree { "state" };
+    
+private:
+    // where the host timeline is at the start of the block, -1 if it doesn't say or isn't playing
+    juce::int64 getHostSamplePosition() const;
+    
+    FrameAnalyzer frameAnalyzer;
+    
+    // message thread
+    bool prepared = false;
+    bool followersWanted = false;
+    
+    juce::SharedResourcePointer<TraceRecorder> tracer;
+    
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PFMProject10AudioProcessor)
+};
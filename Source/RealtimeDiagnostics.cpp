@@ -0,0 +1,198 @@
+/*
+  ==============================================================================
+
+    RealtimeDiagnostics.cpp
+    Created: 18 Oct 2026 5:34:20pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "RealtimeDiagnostics.h"
+
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+
+#include <cstdlib>
+#include <new>
+
+#if JUCE_LINUX
+ #include <sys/resource.h>
+#endif
+
+//==============================================================================
+namespace
+{
+// true while the current thread is inside a ScopedBlock
+thread_local bool isInsideBlock = false;
+}
+
+std::atomic<juce::uint64> RealtimeDiagnostics::audioThreadAllocations { 0 };
+std::atomic<juce::uint64> RealtimeDiagnostics::audioThreadDeallocations { 0 };
+
+//==============================================================================
+RealtimeDiagnostics::ScopedBlock::ScopedBlock(RealtimeDiagnostics& d, const int& numSamples, const double& sampleRate)
+    : diagnostics(d),
+      deadlineSeconds(sampleRate > 0.0 ? numSamples / sampleRate : 0.0),
+      startTicks(juce::Time::getHighResolutionTicks()),
+      startAllocations(audioThreadAllocations.load(std::memory_order_relaxed)),
+      startContextSwitches(getVoluntaryContextSwitches())
+{
+    isInsideBlock = true;
+}
+
+RealtimeDiagnostics::ScopedBlock::~ScopedBlock()
+{
+    isInsideBlock = false;
+    
+    auto elapsedSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+    auto loadPercent = deadlineSeconds > 0.0 ? static_cast<float>(100.0 * elapsedSeconds / deadlineSeconds) : 0.f;
+    
+    auto endContextSwitches = getVoluntaryContextSwitches();
+    auto contextSwitches = startContextSwitches < 0 ? -1 : endContextSwitches - startContextSwitches;
+    
+    diagnostics.recordBlock(loadPercent,
+                            audioThreadAllocations.load(std::memory_order_relaxed) - startAllocations,
+                            contextSwitches);
+}
+
+//==============================================================================
+void RealtimeDiagnostics::noteAllocation()
+{
+    if ( isInsideBlock )
+        audioThreadAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RealtimeDiagnostics::noteDeallocation()
+{
+    if ( isInsideBlock )
+        audioThreadDeallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+juce::int64 RealtimeDiagnostics::getVoluntaryContextSwitches()
+{
+   #if JUCE_LINUX
+    rusage usage;
+    if ( getrusage(RUSAGE_THREAD, &usage) == 0 )
+        return static_cast<juce::int64>(usage.ru_nvcsw);
+   #endif
+   
+    return -1;
+}
+
+void RealtimeDiagnostics::recordBlock(const float& loadPercent, const juce::uint64& allocations, const juce::int64& contextSwitches)
+{
+    auto bin = juce::jlimit(0, numLoadBins - 1, static_cast<int>(loadPercent) / percentPerLoadBin);
+    loadHistogram[bin].fetch_add(1, std::memory_order_relaxed);
+    
+    numBlocks.fetch_add(1, std::memory_order_relaxed);
+    
+    if ( loadPercent > 100.f )
+        numOverruns.fetch_add(1, std::memory_order_relaxed);
+    
+    if ( allocations > 0 )
+        numBlocksWithAllocations.fetch_add(1, std::memory_order_relaxed);
+    
+    if ( contextSwitches < 0 )
+        numBlockingWaits.store(-1, std::memory_order_relaxed);
+    else if ( contextSwitches > 0 )
+        numBlockingWaits.fetch_add(contextSwitches, std::memory_order_relaxed);
+    
+    // only the audio thread writes, so a plain compare and store is enough
+    if ( loadPercent > worstLoadPercent.load(std::memory_order_relaxed) )
+        worstLoadPercent.store(loadPercent, std::memory_order_relaxed);
+}
+
+RealtimeDiagnostics::Snapshot RealtimeDiagnostics::getSnapshot() const
+{
+    Snapshot snapshot;
+    
+    snapshot.numBlocks = numBlocks.load(std::memory_order_relaxed);
+    snapshot.numOverruns = numOverruns.load(std::memory_order_relaxed);
+    snapshot.numAllocations = audioThreadAllocations.load(std::memory_order_relaxed);
+    snapshot.numDeallocations = audioThreadDeallocations.load(std::memory_order_relaxed);
+    snapshot.numBlocksWithAllocations = numBlocksWithAllocations.load(std::memory_order_relaxed);
+    snapshot.numBlockingWaits = numBlockingWaits.load(std::memory_order_relaxed);
+    snapshot.numFifoOverflows = fifoOverflows.load(std::memory_order_relaxed);
+    snapshot.worstLoadPercent = worstLoadPercent.load(std::memory_order_relaxed);
+    
+    for ( auto bin = 0; bin < numLoadBins; ++bin )
+        snapshot.loadHistogram[bin] = loadHistogram[bin].load(std::memory_order_relaxed);
+    
+    return snapshot;
+}
+
+void RealtimeDiagnostics::reset()
+{
+    for ( auto& bin : loadHistogram )
+        bin.store(0, std::memory_order_relaxed);
+    
+    numBlocks.store(0, std::memory_order_relaxed);
+    numOverruns.store(0, std::memory_order_relaxed);
+    numBlocksWithAllocations.store(0, std::memory_order_relaxed);
+    numBlockingWaits.store(0, std::memory_order_relaxed);
+    fifoOverflows.store(0, std::memory_order_relaxed);
+    worstLoadPercent.store(0.f, std::memory_order_relaxed);
+    audioThreadAllocations.store(0, std::memory_order_relaxed);
+    audioThreadDeallocations.store(0, std::memory_order_relaxed);
+}
+
+float RealtimeDiagnostics::Snapshot::getLoadPercentile(const float& fraction) const
+{
+    auto target = static_cast<juce::uint64>(std::ceil(numBlocks * fraction));
+    juce::uint64 count = 0;
+    
+    for ( auto bin = 0; bin < numLoadBins; ++bin )
+    {
+        count += loadHistogram[bin];
+        if ( count >= target )
+            return static_cast<float>((bin + 1) * percentPerLoadBin);
+    }
+    
+    return worstLoadPercent;
+}
+
+//==============================================================================
+/*
+Allocation hooks. Replacing the global operators is the only portable way to
+see every allocation, including the ones JUCE and the standard library make
+on our behalf. The aligned forms are left alone and keep their default pairing.
+*/
+void* operator new(std::size_t size)
+{
+    RealtimeDiagnostics::noteAllocation();
+    
+    if ( auto* ptr = std::malloc(size == 0 ? 1 : size) )
+        return ptr;
+    
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if ( ptr != nullptr )
+        RealtimeDiagnostics::noteDeallocation();
+    
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+#endif
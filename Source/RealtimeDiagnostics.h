@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    RealtimeDiagnostics.h
+    Created: 18 Oct 2026 5:34:20pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+
+// uncomment to instrument processBlock and build the diagnostics panel (cmd/ctrl + shift + D)
+//#define RT_DIAGNOSTICS_ACTIVE
+
+#if defined(RT_DIAGNOSTICS_ACTIVE)
+
+//==============================================================================
+/*
+Evidence of how the plugin behaves on the audio thread.
+Everything is recorded with relaxed atomics so the audio thread never waits,
+and read as a snapshot by the diagnostics panel.
+*/
+struct RealtimeDiagnostics
+{
+    // block time as a percentage of the block's deadline, 5% per bin, the last bin collects the rest
+    static constexpr int numLoadBins = 32;
+    static constexpr int percentPerLoadBin = 5;
+    
+    // wrap processBlock in one of these
+    struct ScopedBlock
+    {
+        ScopedBlock(RealtimeDiagnostics& d, const int& numSamples, const double& sampleRate);
+        ~ScopedBlock();
+    
+    private:
+        RealtimeDiagnostics& diagnostics;
+        double deadlineSeconds;
+        juce::int64 startTicks;
+        juce::uint64 startAllocations;
+        juce::int64 startContextSwitches;
+        
+        JUCE_DECLARE_NON_COPYABLE(ScopedBlock)
+    };
+    
+    void noteFifoOverflow() { fifoOverflows.fetch_add(1, std::memory_order_relaxed); }
+    
+    // called from the global allocation operators; only counted inside a ScopedBlock
+    static void noteAllocation();
+    static void noteDeallocation();
+    
+    // times the audio thread gave up the CPU while processing, i.e. blocked on a lock,
+    // a page fault or a syscall; -1 where the platform can't tell us
+    static juce::int64 getVoluntaryContextSwitches();
+    
+    struct Snapshot
+    {
+        juce::uint64 numBlocks = 0;
+        juce::uint64 numOverruns = 0;
+        juce::uint64 numAllocations = 0;
+        juce::uint64 numDeallocations = 0;
+        juce::uint64 numBlocksWithAllocations = 0;
+        juce::int64 numBlockingWaits = 0;
+        juce::uint64 numFifoOverflows = 0;
+        float worstLoadPercent = 0.f;
+        std::array<juce::uint32, numLoadBins> loadHistogram {};
+        
+        // smallest load that the given fraction of blocks stay under
+        float getLoadPercentile(const float& fraction) const;
+    };
+    
+    Snapshot getSnapshot() const;
+    void reset();
+
+private:
+    void recordBlock(const float& loadPercent, const juce::uint64& allocations, const juce::int64& contextSwitches);
+    
+    std::array<std::atomic<juce::uint32>, numLoadBins> loadHistogram {};
+    std::atomic<juce::uint64> numBlocks { 0 };
+    std::atomic<juce::uint64> numOverruns { 0 };
+    std::atomic<juce::uint64> numBlocksWithAllocations { 0 };
+    std::atomic<juce::int64> numBlockingWaits { 0 };
+    std::atomic<juce::uint64> fifoOverflows { 0 };
+    std::atomic<float> worstLoadPercent { 0.f };
+    
+    // process wide, operator new has no idea which instance it's working for
+    static std::atomic<juce::uint64> audioThreadAllocations;
+    static std::atomic<juce::uint64> audioThreadDeallocations;
+};
+
+#endif
@@ -0,0 +1,360 @@
+/*
+  ==============================================================================
+
+    SessionTimeline.cpp
+    Created: 19 Oct 2026 2:31:40am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "SessionTimeline.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+const std::array<char, 8> magic { 'P', 'F', 'M', 'T', 'L', 'I', 'N', 'E' };
+
+// goes up whenever the layout of the file changes
+constexpr juce::uint32 formatVersion = 1;
+
+const char* fileSuffix = ".pfmtimeline";
+
+} // namespace
+
+static_assert(sizeof(SessionTimeline::Record) == 16, "records are written as they are");
+static_assert(std::is_trivially_copyable<SessionTimeline::Record>::value, "records are written as they are");
+
+//==============================================================================
+juce::int16 SessionTimeline::Record::quantize(const float& db)
+{
+    if ( std::isnan(db) )
+        return -32768;
+    
+    return static_cast<juce::int16>(juce::jlimit(-32768.f, 32767.f, std::round(db * 100.f)));
+}
+
+//==============================================================================
+SessionTimeline::SessionTimeline(const AnalysisHistory& h)
+    : history(h)
+{
+    static_assert(sizeof(Header) == 64, "records stay aligned after the header");
+}
+
+SessionTimeline::~SessionTimeline()
+{
+    stopWriter();
+}
+
+juce::File SessionTimeline::getDirectory()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+        .getChildFile("PFMProject10")
+        .getChildFile("Timelines");
+}
+
+void SessionTimeline::setRecording(const bool& shouldRecord)
+{
+    if ( shouldRecord == recording.load(std::memory_order_relaxed) )
+        return;
+    
+    recording.store(shouldRecord, std::memory_order_relaxed);
+    
+    if ( shouldRecord )
+        writer.startThread();
+    else
+        stopWriter();
+}
+    
+void SessionTimeline::stopWriter()
+{
+    // the writer does a last drain and closes the file on its way out
+    writer.signalThreadShouldExit();
+    writer.notify();
+    writer.stopThread(2000);
+}
+    
+bool SessionTimeline::makeRoom(const juce::int64& fileSize) const
+{
+    auto now = juce::Time::getCurrentTime();
+    auto cutoff = now - juce::RelativeTime::days(daysKept);
+    auto liveSince = now - juce::RelativeTime::milliseconds(liveMs);
+    std::vector<std::pair<juce::Time, juce::File>> others;
+    auto total = fileSize;
+    
+    for ( const auto& entry : juce::RangedDirectoryIterator(getDirectory(), false, juce::String("*") + fileSuffix) )
+    {
+        auto other = entry.getFile();
+        
+        if ( other == file )
+            continue;
+        
+        // another instance is writing it, here or in another host
+        if ( entry.getModificationTime() > liveSince )
+        {
+            total += entry.getFileSize();
+            continue;
+        }
+        
+        if ( entry.getModificationTime() < cutoff && other.deleteFile() )
+            continue;
+        
+        others.push_back({ entry.getModificationTime(), other });
+        total += entry.getFileSize();
+    }
+
+    std::sort(others.begin(), others.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    for ( const auto& other : others )
+    {
+        if ( total <= maxTotalBytes )
+            break;
+    
+        auto size = other.second.getSize();
+        
+        if ( other.second.deleteFile() )
+            total -= size;
+    }
+    
+    return total <= maxTotalBytes;
+}
+
+SessionTimeline::Record SessionTimeline::makeRecord(const AnalysisFrame& frame, const juce::int64& startTimeMs)
+{
+    Record record {};
+    record.timeMs = static_cast<juce::uint32>(juce::jmax(juce::int64(0), frame.timeMs - startTimeMs));
+    
+    for ( auto stream = 0; stream < NumStreams; ++stream )
+    {
+        auto peak = Globals::negInf();
+        auto power = 0.0;
+        auto numChannels = frame.numChannels[stream];
+        
+        for ( auto ch = 0; ch < numChannels; ++ch )
+        {
+            auto lane = AnalysisFrame::getLane(static_cast<Stream>(stream), ch);
+            peak = juce::jmax(peak, frame.peakDb[lane]);
+            power += std::pow(10.0, frame.rmsDb[lane] / 10.0);
+        }
+        
+        auto rms = numChannels > 0 ? static_cast<float>(10.0 * std::log10(power / numChannels)) : Globals::negInf();
+        
+        record.peak[stream] = Record::quantize(peak);
+        record.rms[stream] = Record::quantize(juce::jmax(rms, Globals::negInf()));
+    }
+    
+    record.momentaryLufs = Record::quantize(frame.momentaryLufs);
+    record.shortTermLufs = Record::quantize(frame.shortTermLufs);
+    
+    return record;
+}
+
+juce::int64 SessionTimeline::getFileOffset(const juce::uint64& record)
+{
+    return static_cast<juce::int64>(sizeof(Header) + (record * sizeof(Record)));
+}
+
+//==============================================================================
+void SessionTimeline::Writer::run()
+{
+    if ( !timeline.openFile() )
+        return;
+    
+    auto lastTouched = juce::Time::getCurrentTime();
+    
+    while ( !threadShouldExit() )
+    {
+        timeline.drain();
+        
+        auto now = juce::Time::getCurrentTime();
+        
+        if ( (now - lastTouched).inMilliseconds() >= heartbeatMs && timeline.file.setLastModificationTime(now) )
+            lastTouched = now;
+        
+        wait(pollIntervalMs);
+    }
+    
+    timeline.drain();
+    timeline.closeFile();
+}
+
+bool SessionTimeline::openFile()
+{
+    auto directory = getDirectory();
+    
+    if ( !directory.createDirectory() )
+        return false;
+    
+    auto now = juce::Time::getCurrentTime();
+    file = directory.getNonexistentChildFile("session " + now.formatted("%Y-%m-%d %H-%M-%S"), fileSuffix, false);
+    startTimeMs = now.toMilliseconds();
+    
+    if ( !makeRoom(getFileOffset(recordsPerChunk)) )
+        return false;
+    
+    Header header {};
+    header.magic = magic;
+    header.version = formatVersion;
+    header.recordSize = sizeof(Record);
+    header.startTimeMs = startTimeMs;
+    
+    {
+        juce::FileOutputStream stream(file);
+        
+        if ( stream.failedToOpen() || !stream.write(&header, sizeof(header)) )
+            return false;
+    }
+    
+    headerMap = std::make_unique<juce::MemoryMappedFile>(file, juce::Range<juce::int64>(0, sizeof(Header)),
+                                                         juce::MemoryMappedFile::readWrite);
+    
+    if ( headerMap->getData() == nullptr || !mapChunk(0) )
+    {
+        closeFile();
+        file.deleteFile();
+        return false;
+    }
+    
+    numRecords.store(0, std::memory_order_relaxed);
+    numMissed.store(0, std::memory_order_relaxed);
+    
+    // anything from before the timeline started has no place on it
+    nextFrame = history.getNumWritten();
+    
+    running.store(true, std::memory_order_release);
+    return true;
+}
+
+void SessionTimeline::closeFile()
+{
+    running.store(false, std::memory_order_release);
+    
+    chunk = nullptr;
+    chunkMap.reset();
+    headerMap.reset();
+}
+
+void SessionTimeline::drain()
+{
+    auto written = history.getNumWritten();
+    auto oldest = history.getOldestAvailable();
+    
+    // the writer only falls this far behind if the machine is badly overloaded
+    if ( nextFrame < oldest )
+    {
+        numMissed.fetch_add(oldest - nextFrame, std::memory_order_relaxed);
+        nextFrame = oldest;
+    }
+    
+    auto appended = numRecords.load(std::memory_order_relaxed);
+    auto first = appended;
+    AnalysisFrame frame;
+    
+    for ( ; nextFrame < written; ++nextFrame )
+    {
+        if ( !history.read(nextFrame, frame) )
+        {
+            numMissed.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        
+        // out of disk or over maxTotalBytes; keep counting in case space turns up
+        if ( appended == chunkStart + recordsPerChunk && !mapChunk(appended) )
+        {
+            numMissed.fetch_add(written - nextFrame, std::memory_order_relaxed);
+            nextFrame = written;
+            break;
+        }
+        
+        chunk[appended - chunkStart] = makeRecord(frame, startTimeMs);
+        ++appended;
+    }
+    
+    if ( appended == first )
+        return;
+    
+    auto* header = static_cast<Header*>(headerMap->getData());
+    header->numRecords = appended;
+    
+    numRecords.store(appended, std::memory_order_release);
+}
+
+bool SessionTimeline::mapChunk(const juce::uint64& firstRecord)
+{
+    auto start = getFileOffset(firstRecord);
+    auto end = getFileOffset(firstRecord + recordsPerChunk);
+    
+    // only the writer changes the size of the file, always a whole chunk at a time
+    if ( file.getSize() < end )
+    {
+        if ( !makeRoom(end) )
+            return false;
+        
+        juce::FileOutputStream stream(file);
+        
+        if ( stream.failedToOpen() || !stream.writeRepeatedByte(0, static_cast<size_t>(end - stream.getPosition())) )
+            return false;
+        
+        stream.flush();
+        
+        if ( stream.getStatus().failed() )
+            return false;
+    }
+    
+    auto newMap = std::make_unique<juce::MemoryMappedFile>(file, juce::Range<juce::int64>(start, end),
+                                                           juce::MemoryMappedFile::readWrite);
+    
+    // the mapping starts on a page boundary at or before the chunk
+    if ( newMap->getData() == nullptr || newMap->getRange().getEnd() < end )
+        return false;
+    
+    auto* base = static_cast<char*>(newMap->getData()) + (start - newMap->getRange().getStart());
+    
+    chunkMap = std::move(newMap);
+    chunk = reinterpret_cast<Record*>(base);
+    chunkStart = firstRecord;
+    
+    return true;
+}
+
+//==============================================================================
+juce::uint64 SessionTimeline::Reader::update()
+{
+    // stopped, or stopped and started again on a new file
+    if ( !timeline.isRunning() || timeline.getFile() != mappedFile )
+    {
+        map.reset();
+        records = nullptr;
+        numMapped = 0;
+        mappedFile = juce::File();
+    }
+    
+    if ( !timeline.isRunning() )
+        return 0;
+    
+    auto available = timeline.getNumRecords();
+    
+    // everything the file has room for so far is mapped, so this only happens once a chunk
+    if ( map == nullptr || available > numMapped )
+    {
+        mappedFile = timeline.getFile();
+        map = std::make_unique<juce::MemoryMappedFile>(mappedFile, juce::MemoryMappedFile::readOnly);
+        
+        if ( map->getData() == nullptr || map->getSize() < sizeof(Header) )
+        {
+            map.reset();
+            records = nullptr;
+            numMapped = 0;
+            return 0;
+        }
+        
+        records = reinterpret_cast<const Record*>(static_cast<const char*>(map->getData()) + sizeof(Header));
+        numMapped = (map->getSize() - sizeof(Header)) / sizeof(Record);
+    }
+    
+    return juce::jmin(available, numMapped);
+}
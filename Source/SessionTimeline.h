@@ -0,0 +1,166 @@
+/*
+  ==============================================================================
+
+    SessionTimeline.h
+    Created: 19 Oct 2026 2:31:40am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include "AnalysisHistory.h"
+
+//==============================================================================
+/*
+Levels and loudness for the whole session, one compact record per analysis
+frame, kept in an append-only file rather than in memory: ~55MB a day.
+Off until it's turned on from the editor, so scans, bounces and instances
+nobody asked it of leave nothing behind. While on, a background thread
+creates the file, follows the AnalysisHistory the way the editor does and
+writes each frame through a memory map of the end of the file. Everything
+that touches the disk happens on that thread. Readers map the file themselves
+and can look at any stretch of it without holding the rest in RAM.
+Every instance that records writes its own file, into one directory shared by
+all instances in all hosts, and whichever starts or grows a timeline clears
+out old ones to make room. A timeline touched in the last liveMs is being
+written by someone and is never deleted, so if live timelines alone fill
+maxTotalBytes, the one that wants to grow stops growing instead. One left
+behind by a host that crashed goes quiet and is cleared out like any other.
+*/
+struct SessionTimeline
+{
+    // hundredths of a dB (or LU), plenty for display at a quarter of the size of floats
+    struct Record
+    {
+        // since the timeline started
+        juce::uint32 timeMs;
+        
+        // loudest channel, and power mean of the channels
+        std::array<juce::int16, NumStreams> peak;
+        std::array<juce::int16, NumStreams> rms;
+        
+        // of the main bus
+        juce::int16 momentaryLufs;
+        juce::int16 shortTermLufs;
+        
+        static juce::int16 quantize(const float& db);
+        static float toDb(const juce::int16& value) { return value * 0.01f; }
+    };
+    
+    SessionTimeline(const AnalysisHistory& h);
+    ~SessionTimeline();
+    
+    // message thread. Each time it's turned on a new timeline starts in a new file.
+    void setRecording(const bool& shouldRecord);
+    bool isRecording() const { return recording.load(std::memory_order_relaxed); }
+    
+    // the file has been created and is being written
+    bool isRunning() const { return running.load(std::memory_order_acquire); }
+    
+    // only valid while running
+    juce::File getFile() const { return file; }
+    juce::int64 getStartTimeMs() const { return startTimeMs; }
+    
+    juce::uint64 getNumRecords() const { return numRecords.load(std::memory_order_acquire); }
+    
+    // frames the writer was lapped past, or couldn't write
+    juce::uint64 getNumMissed() const { return numMissed.load(std::memory_order_relaxed); }
+    
+    /*
+    A read-only map of the file, remapped as it grows. Records below the count
+    update() returns are complete and never change.
+    */
+    struct Reader
+    {
+        Reader(const SessionTimeline& t) : timeline(t) { }
+        
+        juce::uint64 update();
+        const Record* getRecords() const { return records; }
+    
+    private:
+        const SessionTimeline& timeline;
+        std::unique_ptr<juce::MemoryMappedFile> map;
+        juce::File mappedFile;
+        const Record* records = nullptr;
+        juce::uint64 numMapped = 0;
+    };
+    
+    // the file grows this many records at a time, 1MB
+    static constexpr juce::uint64 recordsPerChunk = 1 << 16;
+    
+    static constexpr int pollIntervalMs = 100;
+    
+    // writes through a map don't reliably change a file's modification time,
+    // so the writer touches its file this often to show it's live
+    static constexpr int heartbeatMs = 10000;
+    static constexpr int liveMs = 3 * heartbeatMs;
+    
+    // older timelines are deleted when a new one starts
+    static constexpr int daysKept = 7;
+    
+    // all the timelines together; the oldest make way, and one that would be
+    // over the limit on its own stops growing. About 4 1/2 days of one instance.
+    static constexpr juce::int64 maxTotalBytes = juce::int64(256) << 20;
+    
+    static juce::File getDirectory();
+    
+    // timeMs is counted from startTimeMs
+    static Record makeRecord(const AnalysisFrame& frame, const juce::int64& startTimeMs);
+
+private:
+    struct Header
+    {
+        std::array<char, 8> magic;
+        juce::uint32 version;
+        juce::uint32 recordSize;
+        juce::int64 startTimeMs;
+        juce::uint64 numRecords;
+        std::array<char, 32> reserved;
+    };
+    
+    struct Writer : juce::Thread
+    {
+        Writer(SessionTimeline& t) : juce::Thread("Session timeline writer"), timeline(t) { }
+        void run() override;
+        
+        SessionTimeline& timeline;
+    };
+    
+    static juce::int64 getFileOffset(const juce::uint64& record);
+    
+    void stopWriter();
+    
+    // writer thread
+    bool openFile();
+    void closeFile();
+    void drain();
+    bool mapChunk(const juce::uint64& firstRecord);
+    
+    // deletes timelines past their age, then the oldest others until this one
+    // fits at its new size; live ones, this instance's or another's, are left alone
+    bool makeRoom(const juce::int64& fileSize) const;
+    
+    const AnalysisHistory& history;
+    
+    std::atomic<bool> recording { false };
+    std::atomic<bool> running { false };
+    juce::File file;
+    juce::int64 startTimeMs = 0;
+    
+    std::atomic<juce::uint64> numRecords { 0 };
+    std::atomic<juce::uint64> numMissed { 0 };
+    
+    juce::uint64 nextFrame = 0;
+    std::unique_ptr<juce::MemoryMappedFile> headerMap;
+    std::unique_ptr<juce::MemoryMappedFile> chunkMap;
+    Record* chunk = nullptr;
+    juce::uint64 chunkStart = 0;
+    
+    Writer writer { *this };
+};
@@ -0,0 +1,199 @@
+/*
+  ==============================================================================
+
+    SessionTimelineView.cpp
+    Created: 19 Oct 2026 2:58:04am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "SessionTimelineView.h"
+#include "MyColours.h"
+#include "Globals.h"
+#include "LoudnessAnalyzer.h"
+#include <cmath>
+
+//==============================================================================
+void SessionTimelineView::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds();
+    
+    g.fillAll(MyColours::getColour(MyColours::Background).withAlpha(0.96f));
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.setFont(resources->getFont());
+    
+    auto labelArea = bounds.removeFromBottom(16).reduced(4, 0);
+    auto plotArea = bounds.reduced(0, 4);
+    
+    if ( numAvailable == 0 )
+    {
+        g.drawText(timeline.isRecording() ? "SESSION TIMELINE: waiting for audio"
+                                          : "SESSION TIMELINE: not recording, cmd/ctrl + shift + S to start",
+                   plotArea, juce::Justification::centred);
+        return;
+    }
+    
+    auto endRecord = getEndRecord();
+    readColumns(endRecord);
+    
+    auto height = static_cast<float>(plotArea.getHeight());
+    auto top = static_cast<float>(plotArea.getY());
+    
+    auto toY = [&](const float& db)
+    {
+        return top + juce::jmap<float>(juce::jlimit(Globals::negInf(), Globals::maxDb(), db),
+                                       Globals::negInf(), Globals::maxDb(), height, 0.f);
+    };
+    
+    juce::Path rmsPath, loudnessPath;
+    auto penDown = false;
+    
+    for ( auto x = 0; x < static_cast<int>(columns.size()); ++x )
+    {
+        const auto& column = columns[x];
+        
+        if ( column.empty )
+        {
+            penDown = false;
+            continue;
+        }
+        
+        g.setColour(MyColours::getColour(MyColours::GoniometerPath));
+        g.fillRect(juce::Rectangle<float>(static_cast<float>(x), toY(column.peak), 1.f, top + height - toY(column.peak)));
+        
+        if ( penDown )
+        {
+            rmsPath.lineTo(static_cast<float>(x), toY(column.rms));
+            loudnessPath.lineTo(static_cast<float>(x), toY(column.momentary));
+        }
+        else
+        {
+            rmsPath.startNewSubPath(static_cast<float>(x), toY(column.rms));
+            loudnessPath.startNewSubPath(static_cast<float>(x), toY(column.momentary));
+        }
+        
+        penDown = true;
+    }
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.strokePath(rmsPath, juce::PathStrokeType(1.f));
+    
+    g.setColour(MyColours::getColour(MyColours::Yellow));
+    g.strokePath(loudnessPath, juce::PathStrokeType(1.5f));
+    
+    auto span = columns.size() * framesPerColumn;
+    auto startRecord = endRecord > span ? endRecord - span : 0;
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.drawText(getTimeText(startRecord), labelArea, juce::Justification::centredLeft);
+    g.drawText("SESSION TIMELINE  peak / rms / momentary", labelArea, juce::Justification::centred);
+    g.drawText(following ? juce::String("LIVE") : getTimeText(endRecord - 1), labelArea, juce::Justification::centredRight);
+}
+
+void SessionTimelineView::readColumns(const juce::uint64& endRecord)
+{
+    const auto* records = reader.getRecords();
+    auto numColumns = static_cast<juce::uint64>(columns.size());
+    
+    // the newest column ends at endRecord, older ones run off the start of the file
+    for ( juce::uint64 c = 0; c < numColumns; ++c )
+    {
+        auto& column = columns[c];
+        column = { Globals::negInf(), Globals::negInf(), LoudnessAnalyzer::minLufs, true };
+        
+        auto framesBack = (numColumns - c) * framesPerColumn;
+        if ( framesBack > endRecord )
+            continue;
+        
+        auto first = endRecord - framesBack;
+        auto power = 0.0;
+        
+        for ( auto r = first; r < first + framesPerColumn; ++r )
+        {
+            const auto& record = records[r];
+            column.peak = juce::jmax(column.peak, SessionTimeline::Record::toDb(record.peak[Main]));
+            column.momentary = juce::jmax(column.momentary, SessionTimeline::Record::toDb(record.momentaryLufs));
+            power += std::pow(10.0, SessionTimeline::Record::toDb(record.rms[Main]) / 10.0);
+        }
+        
+        column.rms = static_cast<float>(10.0 * std::log10(power / framesPerColumn));
+        column.empty = false;
+    }
+}
+
+juce::uint64 SessionTimelineView::getEndRecord() const
+{
+    return following ? numAvailable : juce::jmin(scrolledEnd, numAvailable);
+}
+
+juce::String SessionTimelineView::getTimeText(const juce::uint64& record) const
+{
+    auto timeMs = timeline.getStartTimeMs() + reader.getRecords()[juce::jmin(record, numAvailable - 1)].timeMs;
+    return juce::Time(timeMs).formatted("%H:%M:%S");
+}
+
+void SessionTimelineView::resized()
+{
+    columns.resize(static_cast<size_t>(juce::jmax(1, getWidth())));
+}
+
+void SessionTimelineView::timerCallback()
+{
+    auto previous = numAvailable;
+    numAvailable = reader.update();
+    
+    if ( numAvailable != previous && following )
+        repaint();
+}
+
+void SessionTimelineView::visibilityChanged()
+{
+    // only poll while someone is looking
+    if ( isVisible() )
+    {
+        following = true;
+        numAvailable = reader.update();
+        startTimerHz(10);
+    }
+    else
+    {
+        stopTimer();
+    }
+}
+
+void SessionTimelineView::mouseDown(const juce::MouseEvent&)
+{
+    dragStartEnd = getEndRecord();
+}
+
+void SessionTimelineView::mouseDrag(const juce::MouseEvent& e)
+{
+    // dragging right goes back in time, like pulling the timeline along
+    auto offset = static_cast<juce::int64>(e.getDistanceFromDragStartX()) * static_cast<juce::int64>(framesPerColumn);
+    auto end = juce::jlimit<juce::int64>(juce::jmin<juce::int64>(static_cast<juce::int64>(numAvailable), 1),
+                                         static_cast<juce::int64>(numAvailable),
+                                         static_cast<juce::int64>(dragStartEnd) - offset);
+    
+    scrolledEnd = static_cast<juce::uint64>(end);
+    following = scrolledEnd >= numAvailable;
+    repaint();
+}
+
+void SessionTimelineView::mouseWheelMove(const juce::MouseEvent&, const juce::MouseWheelDetails& wheel)
+{
+    // zooms about the end of the view, so live stays live
+    if ( wheel.deltaY < 0.f )
+        framesPerColumn = juce::jmin(framesPerColumn * 2, maxFramesPerColumn);
+    else if ( wheel.deltaY > 0.f )
+        framesPerColumn = juce::jmax<juce::uint64>(1, framesPerColumn / 2);
+    
+    repaint();
+}
+
+void SessionTimelineView::mouseDoubleClick(const juce::MouseEvent&)
+{
+    following = true;
+    repaint();
+}
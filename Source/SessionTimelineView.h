@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    SessionTimelineView.h
+    Created: 19 Oct 2026 2:58:04am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "SessionTimeline.h"
+#include "SharedRenderResources.h"
+
+//==============================================================================
+/*
+Hidden overlay scrolling back through the whole session timeline.
+Each column is filled to the loudest peak of the main bus it covers, with the
+RMS and momentary loudness drawn over it. Follows the live end until dragged
+back; the mouse wheel zooms and a double click returns to live.
+Only the records on screen are ever read, so how far back it's looking
+makes no difference to the cost.
+*/
+struct SessionTimelineView : juce::Component, juce::Timer
+{
+    SessionTimelineView(const SessionTimeline& t) : reader(t), timeline(t) { }
+    
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void timerCallback() override;
+    void visibilityChanged() override;
+    
+    void mouseDown(const juce::MouseEvent& e) override;
+    void mouseDrag(const juce::MouseEvent& e) override;
+    void mouseWheelMove(const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel) override;
+    void mouseDoubleClick(const juce::MouseEvent& e) override;
+    
+    // so a column never reads more than 4KB of the file
+    static constexpr juce::uint64 maxFramesPerColumn = 256;
+
+private:
+    struct Column
+    {
+        float peak, rms, momentary;
+        bool empty;
+    };
+    
+    void readColumns(const juce::uint64& endRecord);
+    juce::uint64 getEndRecord() const;
+    juce::String getTimeText(const juce::uint64& record) const;
+    
+    SessionTimeline::Reader reader;
+    const SessionTimeline& timeline;
+    juce::uint64 numAvailable = 0;
+    
+    // sized in resized() so paint() never allocates
+    std::vector<Column> columns;
+    
+    juce::uint64 framesPerColumn = 4;
+    
+    // where the view ends when it isn't following the live end
+    bool following = true;
+    juce::uint64 scrolledEnd = 0;
+    juce::uint64 dragStartEnd = 0;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    SharedRenderResources.cpp
+    Created: 18 Oct 2026 11:02:15am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "SharedRenderResources.h"
+#include "Globals.h"
+
+//==============================================================================
+SharedRenderResources::SharedRenderResources()
+    : font(Globals::font())
+{
+}
+
+std::shared_ptr<const GlyphAtlas> SharedRenderResources::getGlyphAtlas(const juce::Font& glyphFont, const float& scale)
+{
+    for ( auto& atlas : glyphAtlases )
+    {
+        if ( atlas->isPreparedFor(glyphFont, scale) )
+            return atlas;
+    }
+    
+    if ( glyphAtlases.size() >= maxEntriesPerCache )
+        glyphAtlases.erase(glyphAtlases.begin());
+    
+    auto atlas = std::make_shared<GlyphAtlas>();
+    atlas->prepare(glyphFont, scale);
+    glyphAtlases.push_back(atlas);
+    
+    return atlas;
+}
+
+std::shared_ptr<const juce::ColourGradient> SharedRenderResources::getMeterGradient(const float& startCoord,
+                                                                                    const float& endCoord,
+                                                                                    const MyColours::GradientOrientation& orientation)
+{
+    for ( auto& entry : gradients )
+    {
+        if ( entry.startCoord == startCoord && entry.endCoord == endCoord && entry.orientation == orientation )
+            return entry.gradient;
+    }
+    
+    if ( gradients.size() >= maxEntriesPerCache )
+        gradients.erase(gradients.begin());
+    
+    gradients.push_back(GradientEntry
+    {
+        startCoord,
+        endCoord,
+        orientation,
+        std::make_shared<const juce::ColourGradient>(MyColours::getMeterGradient(startCoord, endCoord, orientation))
+    });
+    
+    return gradients.back().gradient;
+}
+
+void SharedRenderResources::renderDropShadow(juce::Graphics& g, const int& width, const int& height)
+{
+    auto shadow = MyColours::getDropShadow();
+    shadow.drawForRectangle(g, juce::Rectangle<int>(MyColours::shadowRadius,
+                                                    MyColours::shadowRadius,
+                                                    width - (MyColours::shadowRadius * 2),
+                                                    height - (MyColours::shadowRadius * 2)));
+}
+
+juce::Image SharedRenderResources::addLayer(LayerEntry&& entry)
+{
+    if ( layers.size() >= maxEntriesPerCache )
+        layers.erase(layers.begin());
+    
+    layers.push_back(std::move(entry));
+    return layers.back().image;
+}
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    SharedRenderResources.h
+    Created: 18 Oct 2026 11:02:15am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "CustomLookAndFeel.h"
+#include "GlyphAtlas.h"
+#include "MyColours.h"
+
+//==============================================================================
+/*
+Render resources shared by every open editor in the process.
+Held through juce::SharedResourcePointer, so the first editor creates it and it
+is destroyed when the last one closes. Message thread only.
+Cached atlases, gradients and layers are handed out shared (layers are
+juce::Images, which already are), so one that another editor's call evicts
+stays valid for as long as a caller holds on to it.
+*/
+struct SharedRenderResources
+{
+    enum class Layer
+    {
+        MeterShadow,
+        CorrelationShadow,
+        GoniometerGraticule
+    };
+    
+    SharedRenderResources();
+    
+    const juce::Font& getFont() const { return font; }
+    
+    std::shared_ptr<const GlyphAtlas> getGlyphAtlas(const juce::Font& glyphFont, const float& scale);
+    
+    std::shared_ptr<const juce::ColourGradient> getMeterGradient(const float& startCoord,
+                                                                 const float& endCoord,
+                                                                 const MyColours::GradientOrientation& orientation);
+    
+    /*
+    Returns a pre-rendered static layer of the given logical size, drawn at the
+    physical scale factor. renderLayer(juce::Graphics&) is only called on a cache
+    miss, with the context already scaled to logical coordinates.
+    */
+    template<typename RenderFunction>
+    juce::Image getLayer(const Layer& layer,
+                         const int& width,
+                         const int& height,
+                         const float& scale,
+                         RenderFunction&& renderLayer)
+    {
+        for ( auto& cached : layers )
+        {
+            if ( cached.layer == layer && cached.width == width && cached.height == height && cached.scale == scale )
+                return cached.image;
+        }
+        
+        auto image = juce::Image(juce::Image::ARGB,
+                                 juce::jmax(1, juce::roundToInt(width * scale)),
+                                 juce::jmax(1, juce::roundToInt(height * scale)),
+                                 true);
+        {
+            juce::Graphics g (image);
+            g.addTransform(juce::AffineTransform::scale(scale));
+            renderLayer(g);
+        }
+        
+        return addLayer({ layer, width, height, scale, image });
+    }
+    
+    /*
+    Draws a drop shadow for a rectangle of the given size into a layer that is
+    MyColours::shadowRadius larger on every side, so the result can be drawn at
+    bounds.expanded(MyColours::shadowRadius).
+    */
+    static void renderDropShadow(juce::Graphics& g, const int& width, const int& height);
+    
+    CustomLookAndFeel lookAndFeel;
+
+private:
+    struct GradientEntry
+    {
+        float startCoord;
+        float endCoord;
+        MyColours::GradientOrientation orientation;
+        std::shared_ptr<const juce::ColourGradient> gradient;
+    };
+    
+    struct LayerEntry
+    {
+        Layer layer;
+        int width;
+        int height;
+        float scale;
+        juce::Image image;
+    };
+    
+    juce::Image addLayer(LayerEntry&& entry);
+    
+    // every editor has the same handful of sizes, so the caches stay tiny;
+    // the limit only guards against a host that resizes continuously
+    static constexpr size_t maxEntriesPerCache = 32;
+    
+    juce::Font font;
+    std::vector<std::shared_ptr<GlyphAtlas>> glyphAtlases;
+    std::vector<GradientEntry> gradients;
+    std::vector<LayerEntry> layers;
+};
@@ -0,0 +1,237 @@
+/*
+  ==============================================================================
+
+    SignalGenerator.cpp
+    Created: 18 Oct 2026 11:04:16pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "SignalGenerator.h"
+
+//==============================================================================
+const char* SignalGenerator::getTypeName(const Type& t)
+{
+    switch (t)
+    {
+        case Off:           return "Off";
+        case Sine:          return "Sine 1kHz";
+        case MultiTone:     return "Multi-tone";
+        case LogSweep:      return "Log sweep";
+        case WhiteNoise:    return "White noise";
+        case PinkNoise:     return "Pink noise";
+        case EbuTone:       return "EBU -23 LUFS";
+        case AtscTone:      return "ATSC -24 LKFS";
+        case PhaseInverted: return "Phase inverted";
+        case Decorrelated:  return "Decorrelated";
+        case NumTypes:      break;
+    }
+    
+    return "";
+}
+
+void SignalGenerator::prepare(const double& newSampleRate, const int& maxBlockSize)
+{
+    sampleRate = newSampleRate;
+    
+    left.assign(static_cast<size_t>(juce::jmax(1, maxBlockSize)), 0.f);
+    right.assign(left.size(), 0.f);
+    
+    reset(type.load());
+}
+
+void SignalGenerator::render(juce::AudioBuffer<float>& buffer)
+{
+    auto current = type.load();
+    if ( current == Off || left.empty() )
+        return;
+    
+    if ( current != currentType )
+        reset(current);
+    
+    auto gain = getGain(current);
+    auto chunkSize = static_cast<int>(left.size());
+    
+    // hosts may send more than they announced, so work through it in chunks the scratch can hold
+    for ( auto start = 0; start < buffer.getNumSamples(); start += chunkSize )
+    {
+        auto numSamples = juce::jmin(chunkSize, buffer.getNumSamples() - start);
+        generate(current, numSamples);
+        
+        for ( auto ch = 0; ch < buffer.getNumChannels(); ++ch )
+        {
+            auto* source = (ch % 2 == 1 && rightIsIndependent) ? right.data() : left.data();
+            juce::FloatVectorOperations::copyWithMultiply(buffer.getWritePointer(ch, start), source, gain, numSamples);
+        }
+    }
+}
+
+void SignalGenerator::reset(const Type& newType)
+{
+    currentType = newType;
+    rightIsIndependent = newType == PhaseInverted || newType == Decorrelated;
+    
+    const double frequencies[] { 100.0, 1000.0, 5000.0, 10000.0 };
+    
+    for ( size_t i = 0; i < oscillators.size(); ++i )
+    {
+        // tones the sample rate can't carry are left out rather than aliased
+        auto frequency = newType == MultiTone ? frequencies[i] : 1000.0;
+        oscillators[i].setFrequency(frequency < sampleRate * 0.45 ? frequency : 0.0, sampleRate);
+        oscillators[i].reset();
+    }
+    
+    auto sweepEnd = juce::jmin(20000.0, sampleRate * 0.45);
+    sweepFrequency = 20.0;
+    sweepPhase = 0.0;
+    sweepMultiplier = std::pow(sweepEnd / 20.0, 1.0 / (sweepSeconds * sampleRate));
+    
+    // the same seeds every time, so a signal is repeatable, and different ones per side
+    noise[0].state = 0x9E3779B9u;
+    noise[1].state = 0x85EBCA6Bu;
+    
+    for ( auto& filter : pink )
+        filter.b.fill(0.f);
+}
+
+float SignalGenerator::getGain(const Type& current) const
+{
+    switch (current)
+    {
+        case EbuTone:   return juce::Decibels::decibelsToGain(-23.f);
+        case AtscTone:  return juce::Decibels::decibelsToGain(-24.f);
+        case MultiTone: return juce::Decibels::decibelsToGain(level.load()) / static_cast<float>(oscillators.size());
+        default:        return juce::Decibels::decibelsToGain(level.load());
+    }
+}
+
+void SignalGenerator::generate(const Type& current, const int& numSamples)
+{
+    using FVO = juce::FloatVectorOperations;
+    
+    switch (current)
+    {
+        case Sine:
+        case EbuTone:
+        case AtscTone:
+        case PhaseInverted:
+        {
+            FVO::clear(left.data(), numSamples);
+            oscillators[0].add(left.data(), numSamples, 1.f);
+            
+            if ( current == PhaseInverted )
+                FVO::negate(right.data(), left.data(), numSamples);
+            
+            break;
+        }
+        case MultiTone:
+        {
+            FVO::clear(left.data(), numSamples);
+            
+            for ( auto& oscillator : oscillators )
+                oscillator.add(left.data(), numSamples, 1.f);
+            
+            break;
+        }
+        case LogSweep:
+        {
+            for ( auto i = 0; i < numSamples; ++i )
+            {
+                left[i] = static_cast<float>(std::sin(sweepPhase));
+                
+                sweepPhase += juce::MathConstants<double>::twoPi * sweepFrequency / sampleRate;
+                if ( sweepPhase > juce::MathConstants<double>::twoPi )
+                    sweepPhase -= juce::MathConstants<double>::twoPi;
+                
+                sweepFrequency *= sweepMultiplier;
+                if ( sweepFrequency > 20000.0 || sweepFrequency > sampleRate * 0.45 )
+                    sweepFrequency = 20.0;
+            }
+            
+            break;
+        }
+        case WhiteNoise:
+        case Decorrelated:
+        {
+            for ( auto i = 0; i < numSamples; ++i )
+                left[i] = noise[0].next();
+            
+            if ( current == Decorrelated )
+            {
+                for ( auto i = 0; i < numSamples; ++i )
+                    right[i] = noise[1].next();
+            }
+            
+            break;
+        }
+        case PinkNoise:
+        {
+            for ( auto i = 0; i < numSamples; ++i )
+                left[i] = pink[0].process(noise[0].next());
+            
+            break;
+        }
+        case Off:
+        case NumTypes:
+            break;
+    }
+}
+
+//==============================================================================
+void SignalGenerator::Oscillator::setFrequency(const double& hz, const double& sampleRate)
+{
+    auto increment = juce::MathConstants<double>::twoPi * hz / sampleRate;
+    rotationCos = static_cast<float>(std::cos(increment));
+    rotationSin = static_cast<float>(std::sin(increment));
+    
+    // a 0Hz oscillator is silent rather than DC
+    if ( hz <= 0.0 )
+        cosine = sine = rotationCos = rotationSin = 0.f;
+}
+
+void SignalGenerator::Oscillator::add(float* destination, const int& numSamples, const float& gain)
+{
+    auto c = cosine;
+    auto s = sine;
+    
+    for ( auto i = 0; i < numSamples; ++i )
+    {
+        destination[i] += gain * s;
+        
+        auto nextC = (c * rotationCos) - (s * rotationSin);
+        s = (s * rotationCos) + (c * rotationSin);
+        c = nextC;
+    }
+    
+    // rounding makes the amplitude drift, pull it back to 1 once per chunk
+    auto magnitude = std::sqrt((c * c) + (s * s));
+    cosine = magnitude > 0.f ? c / magnitude : 0.f;
+    sine = magnitude > 0.f ? s / magnitude : 0.f;
+}
+
+float SignalGenerator::Noise::next()
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    
+    // top 24 bits to -1..1
+    return (static_cast<float>(state >> 8) * (2.f / 16777216.f)) - 1.f;
+}
+
+float SignalGenerator::PinkFilter::process(const float& white)
+{
+    b[0] = (0.99886f * b[0]) + (white * 0.0555179f);
+    b[1] = (0.99332f * b[1]) + (white * 0.0750759f);
+    b[2] = (0.96900f * b[2]) + (white * 0.1538520f);
+    b[3] = (0.86650f * b[3]) + (white * 0.3104856f);
+    b[4] = (0.55000f * b[4]) + (white * 0.5329522f);
+    b[5] = (-0.7616f * b[5]) - (white * 0.0168980f);
+    
+    auto pinkSample = b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + (white * 0.5362f);
+    b[6] = white * 0.115926f;
+    
+    // peaks a little under unity
+    return pinkSample * 0.11f;
+}
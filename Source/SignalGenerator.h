@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    SignalGenerator.h
+    Created: 18 Oct 2026 11:04:16pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+//==============================================================================
+/*
+Test signals for calibrating the meters and load testing them without
+audio files.
+The signal is chosen at runtime from any thread, and rendered on the
+audio thread into preallocated scratch buffers (one per side of a stereo
+pair), so render() never allocates. Channels beyond the first pair repeat
+it. The level is the peak in dBFS (noise peaks close to it), except for
+the loudness tones, which are fixed by their standards.
+*/
+struct SignalGenerator
+{
+    enum Type
+    {
+        Off,
+        Sine,           // 1kHz
+        MultiTone,      // 100Hz, 1kHz, 5kHz and 10kHz, equal level
+        LogSweep,       // 20Hz to 20kHz over 10s, repeating
+        WhiteNoise,
+        PinkNoise,
+        EbuTone,        // 1kHz at -23dBFS, reads -23 LUFS (EBU Tech 3341)
+        AtscTone,       // 1kHz at -24dBFS, reads -24 LKFS (ATSC A/85)
+        PhaseInverted,  // 1kHz with the right channel inverted, correlation -1
+        Decorrelated,   // independent white noise per side, correlation 0
+        NumTypes
+    };
+    
+    static const char* getTypeName(const Type& type);
+    
+    void prepare(const double& sampleRate, const int& maxBlockSize);
+    
+    // safe from any thread, picked up at the next render()
+    void setType(const Type& newType) { type.store(newType); }
+    Type getType() const { return type.load(); }
+    void setLevel(const float& peakDbfs) { level.store(peakDbfs); }
+    
+    // overwrites every channel of buffer, leaves it alone when Off
+    void render(juce::AudioBuffer<float>& buffer);
+    
+    static constexpr float defaultLevel = -18.f; // EBU R 68 alignment level
+
+private:
+    // quadrature oscillator, one multiply-add rotation per sample
+    struct Oscillator
+    {
+        void setFrequency(const double& hz, const double& sampleRate);
+        void reset() { cosine = 1.f; sine = 0.f; }
+        void add(float* destination, const int& numSamples, const float& gain);
+        
+        float cosine = 1.f;
+        float sine = 0.f;
+        float rotationCos = 1.f;
+        float rotationSin = 0.f;
+    };
+    
+    // xorshift, no state beyond one word
+    struct Noise
+    {
+        float next();
+        juce::uint32 state = 1;
+    };
+    
+    // Paul Kellet's filter on white noise
+    struct PinkFilter
+    {
+        float process(const float& white);
+        std::array<float, 7> b {};
+    };
+    
+    void reset(const Type& newType);
+    void generate(const Type& current, const int& numSamples);
+    float getGain(const Type& current) const;
+    
+    std::atomic<Type> type { Off };
+    std::atomic<float> level { defaultLevel };
+    Type currentType = Off;
+    
+    double sampleRate = 48000.0;
+    
+    std::vector<float> left;
+    std::vector<float> right;
+    bool rightIsIndependent = false;
+    
+    std::array<Oscillator, 4> oscillators;
+    std::array<Noise, 2> noise;
+    std::array<PinkFilter, 2> pink;
+    
+    double sweepPhase = 0.0;
+    double sweepFrequency = 20.0;
+    double sweepMultiplier = 1.0;
+    static constexpr double sweepSeconds = 10.0;
+};
@@ -1,151 +1,160 @@
-/*
-  ==============================================================================
-
-    StereoMeter.cpp
-    Created: 2 Apr 2022 1:11:51am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#include "StereoMeter.h"
-#include "MyColours.h"
-#include "Globals.h"
-
-//==============================================================================
-StereoMeter::StereoMeter(const juce::String& labelText)
-    : label(labelText)
-{
-    addAndMakeVisible(macroMeterL);
-    addAndMakeVisible(dbScale);
-    addAndMakeVisible(macroMeterR);
-    addAndMakeVisible(threshCtrl);
-}
-
-void StereoMeter::paint(juce::Graphics& g)
-{
-    auto bounds = getLocalBounds();
-    auto h = bounds.getHeight();
-    auto w = bounds.getWidth();
-    auto labelContainerY = static_cast<int>(h * dbScaleLabelCrossover);
-    auto labelContainerH = static_cast<int>(h - labelContainerY);
-    
-    g.setColour(MyColours::getColour(MyColours::Text));
-    g.setFont(Globals::font());
-    
-    std::vector<juce::String> labels{"L", label, "R"};
-    std::vector<int> xPositions{0, static_cast<int>(w / 3), static_cast<int>(w - (w / 3))};
-    
-    for (auto i = 0; i < labels.size(); ++i)
-    {
-        g.drawFittedText(labels[i],                                // text
-                         xPositions[i],                            // x
-                         labelContainerY,                          // y
-                         static_cast<int>(w / 3),                  // width
-                         labelContainerH,                          // height
-                         juce::Justification::horizontallyCentred, // justification
-                         1);                                       // max num lines
-    }
-}
-
-void StereoMeter::resized()
-{
-    auto bounds = getLocalBounds();
-    auto h = bounds.getHeight();
-    auto w = bounds.getWidth();
-    auto meterWidth = static_cast<int>(w * 0.35f);
-    auto meterHeight = static_cast<int>(h * 0.92f);
-    
-    auto dbScaleWidth = w - (meterWidth * 2);
-    
-    macroMeterL.setBounds(0, 0, meterWidth, meterHeight);
-    
-    dbScale.ticks = macroMeterL.getTicks();
-    auto tickYoffset = macroMeterL.getTickYoffset();
-    dbScale.yOffset = macroMeterL.getY() + tickYoffset;
-    dbScale.setBounds(macroMeterL.getRight(),
-                      0,
-                      dbScaleWidth,
-                      static_cast<int>(h * dbScaleLabelCrossover));
-    
-    macroMeterR.setBounds(dbScale.getRight(), 0, meterWidth, meterHeight);
-    
-    auto offset = macroMeterL.getTickYoffset();
-    threshCtrl.setBounds(dbScale.getX(),
-                         macroMeterL.getY() + offset,
-                         dbScale.getWidth(),
-                         macroMeterL.getHeight() - offset);
-}
-
-void StereoMeter::update(const float& inputL, const float& inputR)
-{
-    macroMeterL.update(inputL);
-    macroMeterR.update(inputR);
-}
-
-void StereoMeter::setThreshold(const float& threshAsDecibels)
-{
-    macroMeterL.setThreshold(threshAsDecibels);
-    macroMeterR.setThreshold(threshAsDecibels);
-}
-
-void StereoMeter::setDecayRate(const int& selectedId)
-{
-    float dbPerSecond;
-    
-    switch (selectedId)
-    {
-        case 1:  dbPerSecond = 3.f;  break;
-        case 2:  dbPerSecond = 6.f;  break;
-        case 3:  dbPerSecond = 12.f; break;
-        case 4:  dbPerSecond = 24.f; break;
-        case 5:  dbPerSecond = 36.f; break;
-        default: dbPerSecond = 12.f; break;
-    }
-    
-    macroMeterL.setDecayRate(dbPerSecond);
-    macroMeterR.setDecayRate(dbPerSecond);
-}
-
-void StereoMeter::setTickVisibility(const bool& toggleState)
-{
-    macroMeterL.setTickVisibility(toggleState);
-    macroMeterR.setTickVisibility(toggleState);
-}
-
-void StereoMeter::setTickHoldTime(const int& selectedId)
-{
-    long long holdTimeMs;
-    
-    switch (selectedId)
-    {
-        case 1:  holdTimeMs = 0;        break;
-        case 2:  holdTimeMs = 500;      break;
-        case 3:  holdTimeMs = 2000;     break;
-        case 4:  holdTimeMs = 4000;     break;
-        case 5:  holdTimeMs = 6000;     break;
-        case 6:  holdTimeMs = INFINITY; break;
-        default: holdTimeMs = 500;      break;
-    }
-    
-    macroMeterL.setHoldTime(holdTimeMs);
-    macroMeterR.setHoldTime(holdTimeMs);
-}
-
-void StereoMeter::resetValueHolder()
-{
-    macroMeterL.resetValueHolder();
-    macroMeterR.resetValueHolder();
-}
-
-void StereoMeter::setMeterView(const int& newViewId)
-{
-    macroMeterL.setMeterView(newViewId);
-    macroMeterR.setMeterView(newViewId);
-}
-
-void StereoMeter::resizeAverager(const int& durationId)
-{
-    macroMeterL.resizeAverager(durationId);
-    macroMeterR.resizeAverager(durationId);
-}
+/*
+  ==============================================================================
+
+    StereoMeter.cpp
+    Created: 2 Apr 2022 1:11:51am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "StereoMeter.h"
+#include "MyColours.h"
+
+//==============================================================================
+StereoMeter::StereoMeter(const juce::String& labelText, FrameProfiler& p)
+    : label(labelText),
+      profiler(p)
+{
+    addAndMakeVisible(dbScale);
+    addAndMakeVisible(threshCtrl);
+    
+    setChannelLayout(juce::AudioChannelSet::stereo());
+}
+
+void StereoMeter::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds();
+    auto h = bounds.getHeight();
+    auto labelContainerY = static_cast<int>(h * dbScaleLabelCrossover);
+    auto labelContainerH = static_cast<int>(h - labelContainerY);
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    g.setFont(resources->getFont());
+    
+    auto drawLabel = [&](const juce::String& text, const int& x, const int& width)
+    {
+        g.drawFittedText(text,                                     // text
+                         x,                                        // x
+                         labelContainerY,                          // y
+                         width,                                    // width
+                         labelContainerH,                          // height
+                         juce::Justification::horizontallyCentred, // justification
+                         1);                                       // max num lines
+    };
+    
+    for ( auto i = 0; i < macroMeters.size(); ++i )
+        drawLabel(channelLabels[i], macroMeters[i]->getX(), macroMeters[i]->getWidth());
+    
+    drawLabel(label, dbScale.getX(), dbScale.getWidth());
+}
+
+void StereoMeter::resized()
+{
+    auto bounds = getLocalBounds();
+    auto h = bounds.getHeight();
+    auto w = bounds.getWidth();
+    auto numChannels = juce::jmax(1, macroMeters.size());
+    auto meterWidth = static_cast<int>(w * 0.7f / juce::jmax(2, numChannels));
+    auto meterHeight = static_cast<int>(h * 0.92f);
+    
+    if ( numChannels == 1 )
+        meterWidth *= 2;
+    
+    auto dbScaleWidth = w - (meterWidth * numChannels);
+    auto x = 0;
+    
+    for ( auto i = 0; i < numChannels; ++i )
+    {
+        if ( i == numLeftOfScale )
+        {
+            dbScale.setBounds(x, 0, dbScaleWidth, static_cast<int>(h * dbScaleLabelCrossover));
+            x = dbScale.getRight();
+        }
+        
+        macroMeters[i]->setBounds(x, 0, meterWidth, meterHeight);
+        x += meterWidth;
+    }
+    
+    if ( numLeftOfScale == numChannels )
+        dbScale.setBounds(x, 0, dbScaleWidth, static_cast<int>(h * dbScaleLabelCrossover));
+    
+    auto* firstMeter = macroMeters.getFirst();
+    auto tickYoffset = firstMeter->getTickYoffset();
+    
+    dbScale.ticks = firstMeter->getTicks();
+    dbScale.yOffset = firstMeter->getY() + tickYoffset;
+    
+    threshCtrl.setBounds(dbScale.getX(),
+                         firstMeter->getY() + tickYoffset,
+                         dbScale.getWidth(),
+                         firstMeter->getHeight() - tickYoffset);
+}
+
+void StereoMeter::update(const MeterBallistics& ballistics, const MeterBallistics* reference)
+{
+    auto numChannels = juce::jmin(macroMeters.size(), ballistics.getNumChannels());
+    
+    for ( auto i = 0; i < numChannels; ++i )
+        macroMeters[i]->update(ballistics, i, reference);
+}
+
+void StereoMeter::setChannelLayout(const juce::AudioChannelSet& layout)
+{
+    auto numChannels = juce::jlimit(1, Globals::maxChannels, layout.size());
+    
+    macroMeters.clear();
+    channelLabels.clear();
+    numLeftOfScale = (numChannels + 1) / 2;
+    
+    for ( auto i = 0; i < numChannels; ++i )
+    {
+        auto name = layout.size() > i ? juce::AudioChannelSet::getAbbreviatedChannelTypeName(layout.getTypeOfChannel(i))
+                                      : juce::String();
+        channelLabels.add(name.isNotEmpty() ? name : juce::String(i + 1));
+        
+        auto* macroMeter = macroMeters.add(new MacroMeter(i < numLeftOfScale ? Channel::Left : Channel::Right,
+                                                          profiler,
+                                                          label + " " + channelLabels[i]));
+        addAndMakeVisible(macroMeter);
+        
+        macroMeter->setThreshold(threshold);
+        macroMeter->setTickVisibility(tickVisibility);
+        macroMeter->setMeterView(meterView);
+    }
+    
+    if ( !getLocalBounds().isEmpty() )
+        resized();
+    
+    repaint();
+}
+
+int StereoMeter::getPreferredWidth(const int& numChannels)
+{
+    // stereo is the reference size, wider layouts get narrower strips
+    return numChannels <= 2 ? 90 : 27 + (numChannels * 22);
+}
+
+void StereoMeter::setThreshold(const float& threshAsDecibels)
+{
+    threshold = threshAsDecibels;
+    
+    for ( auto* macroMeter : macroMeters )
+        macroMeter->setThreshold(threshAsDecibels);
+}
+
+void StereoMeter::setTickVisibility(const bool& toggleState)
+{
+    tickVisibility = toggleState;
+    
+    for ( auto* macroMeter : macroMeters )
+        macroMeter->setTickVisibility(toggleState);
+}
+
+void StereoMeter::setMeterView(const int& newViewId)
+{
+    meterView = newViewId;
+    
+    for ( auto* macroMeter : macroMeters )
+        macroMeter->setMeterView(newViewId);
+}
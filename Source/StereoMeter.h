@@ -1,49 +1,63 @@
-/*
-  ==============================================================================
-
-    StereoMeter.h
-    Created: 2 Apr 2022 1:11:51am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "ThresholdSlider.h"
-#include "MacroMeter.h"
-#include "DbScale.h"
-#include "CustomLookAndFeel.h"
-
-//==============================================================================
-struct StereoMeter : juce::Component
-{
-    StereoMeter(const juce::String& labelText);
-    
-    void paint(juce::Graphics& g) override;
-    void resized() override;
-    void update(const float& inputL, const float& inputR);
-    
-    void setThreshold(const float& threshAsDecibels);
-    void setDecayRate(const int& selectedId);
-    
-    void setTickVisibility(const bool& toggleState);
-    void setTickHoldTime(const int& selectedId);
-    void resetValueHolder();
-    void setMeterView(const int& newViewId);
-    
-    void resizeAverager(const int& durationId);
-    
-    ThresholdSlider threshCtrl;
-private:
-    MacroMeter macroMeterL{ Channel::Left };
-    DbScale dbScale;
-    MacroMeter macroMeterR{ Channel::Right };
-    
-    juce::String label;
-    
-    float dbScaleLabelCrossover = 0.94f;
-    
-    CustomLookAndFeel customStyle;
-};
+/*
+  ==============================================================================
+
+    StereoMeter.h
+    Created: 2 Apr 2022 1:11:51am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ThresholdSlider.h"
+#include "MacroMeter.h"
+#include "MeterBallistics.h"
+#include "DbScale.h"
+#include "SharedRenderResources.h"
+
+//==============================================================================
+/*
+One meter strip per channel with a shared dB scale.
+Laid out L | scale | R for stereo; for other layouts the first half of the
+channels sit left of the scale and the rest sit right of it.
+*/
+struct StereoMeter : juce::Component
+{
+    StereoMeter(const juce::String& labelText, FrameProfiler& profiler);
+    
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    // reference is the sidechain, drawn as markers over the main meters when present
+    void update(const MeterBallistics& ballistics, const MeterBallistics* reference);
+    
+    void setChannelLayout(const juce::AudioChannelSet& layout);
+    int getNumChannels() const { return macroMeters.size(); }
+    static int getPreferredWidth(const int& numChannels);
+    
+    void setThreshold(const float& threshAsDecibels);
+    
+    void setTickVisibility(const bool& toggleState);
+    void setMeterView(const int& newViewId);
+    
+    ThresholdSlider threshCtrl;
+private:
+    juce::OwnedArray<MacroMeter> macroMeters;
+    juce::StringArray channelLabels;
+    int numLeftOfScale = 1;
+    
+    DbScale dbScale;
+    
+    juce::String label;
+    
+    float dbScaleLabelCrossover = 0.94f;
+    float threshold = 0.f;
+    bool tickVisibility = true;
+    int meterView = 1;
+    
+    // handed to the meters, which are rebuilt whenever the layout changes
+    FrameProfiler& profiler;
+    
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
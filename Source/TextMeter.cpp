@@ -1,47 +1,42 @@
-/*
-  ==============================================================================
-
-    TextMeter.cpp
-    Created: 2 Apr 2022 1:01:42am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#include "TextMeter.h"
-#include "MyColours.h"
-#include "Globals.h"
-
-//==============================================================================
-void TextMeter::paint(juce::Graphics& g)
-{
-    juce::String str;
-    
-    if ( valueHolder.isOverThreshold() )
-    {
-        str = juce::String(valueHolder.getHeldValue(), 1);
-        g.fillAll(MyColours::getColour(MyColours::Red)); // background
-    }
-    else
-    {
-        str = juce::String(valueHolder.getCurrentValue(), 1);
-    }
-    
-    g.setColour(MyColours::getColour(MyColours::Text));
-    g.setFont(Globals::font());
-    g.drawFittedText(str,                                      // text
-                     getLocalBounds(),                         // area
-                     juce::Justification::horizontallyCentred, // justification
-                     1);                                       // max num lines
-}
-
-void TextMeter::update(const float& input)
-{
-    valueHolder.updateHeldValue(input);
-    repaint();
-}
-
-void TextMeter::setThreshold(const float& threshAsDecibels)
-{
-    valueHolder.setThreshold(threshAsDecibels);
-}
+/*
+  ==============================================================================
+
+    TextMeter.cpp
+    Created: 2 Apr 2022 1:01:42am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "TextMeter.h"
+#include "MyColours.h"
+#include "Globals.h"
+
+//==============================================================================
+void TextMeter::paint(juce::Graphics& g)
+{
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    auto glyphs = resources->getGlyphAtlas(resources->getFont(), scale);
+    
+    if ( isOverThreshold )
+        g.fillAll(MyColours::getColour(MyColours::Red)); // background
+    
+    g.setColour(MyColours::getColour(MyColours::Text));
+    
+    if ( value <= Globals::negInf() )
+        glyphs->drawNegativeInfinity(g, getLocalBounds(), juce::Justification::horizontallyCentred);
+    else
+        glyphs->drawValue(g,                                         // graphics context
+                          value,                                     // value
+                          1,                                         // decimal places
+                          false,                                     // show plus sign
+                          getLocalBounds(),                          // area
+                          juce::Justification::horizontallyCentred); // justification
+}
+
+void TextMeter::update(const float& newValue, const bool& overThreshold)
+{
+    value = newValue;
+    isOverThreshold = overThreshold;
+    repaint();
+}
@@ -1,26 +1,26 @@
-/*
-  ==============================================================================
-
-    ThresholdSlider.h
-    Created: 2 Apr 2022 1:10:42am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-#include <JuceHeader.h>
-#include "CustomLookAndFeel.h"
-
-//==============================================================================
-struct ThresholdSlider : juce::Slider
-{
-    ThresholdSlider();
-    ~ThresholdSlider();
-    
-    void paint(juce::Graphics& g) override;
-    
-private:
-    CustomLookAndFeel lnf;
-};
+/*
+  ==============================================================================
+
+    ThresholdSlider.h
+    Created: 2 Apr 2022 1:10:42am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SharedRenderResources.h"
+
+//==============================================================================
+struct ThresholdSlider : juce::Slider
+{
+    ThresholdSlider();
+    ~ThresholdSlider();
+    
+    void paint(juce::Graphics& g) override;
+    
+private:
+    juce::SharedResourcePointer<SharedRenderResources> resources;
+};
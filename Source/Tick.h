@@ -1,18 +1,18 @@
-/*
-  ==============================================================================
-
-    Tick.h
-    Created: 2 Apr 2022 1:03:12am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-//==============================================================================
-struct Tick
-{
-    int y = 0;
-    float db = 0.f;
-};
+/*
+  ==============================================================================
+
+    Tick.h
+    Created: 2 Apr 2022 1:03:12am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//==============================================================================
+struct Tick
+{
+    int y = 0;
+    float db = 0.f;
+};
@@ -1,21 +1,21 @@
-/*
-  ==============================================================================
-
-    ToggleGroup.h
-    Created: 2 Apr 2022 1:21:55am
-    Author:  Matt Aiken
-
-  ==============================================================================
-*/
-
-#pragma once
-
-//==============================================================================
-enum class ToggleGroup
-{
-    DecayRate,
-    AverageTime,
-    MeterView,
-    HoldTime,
-    HistView
-};
+/*
+  ==============================================================================
+
+    ToggleGroup.h
+    Created: 2 Apr 2022 1:21:55am
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+//==============================================================================
+enum class ToggleGroup
+{
+    DecayRate,
+    AverageTime,
+    MeterView,
+    HoldTime,
+    HistView
+};
@@ -0,0 +1,270 @@
+/*
+  ==============================================================================
+
+    TraceRecorder.cpp
+    Created: 18 Oct 2026 7:48:26pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#include "TraceRecorder.h"
+
+//==============================================================================
+TraceRecorder::TraceRecorder()
+{
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    stopRecording();
+}
+
+bool TraceRecorder::startRecording(const juce::File& file)
+{
+    stopRecording();
+    
+    file.deleteFile();
+    auto newStream = std::make_unique<juce::FileOutputStream>(file);
+    
+    if ( newStream->failedToOpen() )
+        return false;
+    
+    // the rings are only allocated once somebody actually wants a trace
+    for ( auto& ring : rings )
+    {
+        if ( ring.events == nullptr )
+            ring.events = std::make_unique<Event[]>(eventsPerThread);
+        
+        // anything left over from an earlier capture is skipped
+        ring.readIndex.store(ring.writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+    }
+    
+    destination = file;
+    stream = std::move(newStream);
+    startTicks = juce::Time::getHighResolutionTicks();
+    firstEventWritten = false;
+    namedThreads.clear();
+    droppedEvents.store(0, std::memory_order_relaxed);
+    
+    *stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    
+    recording.store(true, std::memory_order_release);
+    writer.startThread();
+    
+    return true;
+}
+
+void TraceRecorder::stopRecording()
+{
+    if ( !isRecording() )
+        return;
+    
+    recording.store(false, std::memory_order_release);
+    
+    // the writer does a last drain on its way out
+    writer.signalThreadShouldExit();
+    writer.notify();
+    writer.stopThread(2000);
+    
+    *stream << "\n],\"otherData\":{\"droppedEvents\":" << juce::String(droppedEvents.load()) << "}}\n";
+    stream->flush();
+    stream.reset();
+}
+
+void TraceRecorder::beginEvent(const char* name, const char* category)
+{
+    auto* ring = findRingForThisThread();
+    
+    if ( ring == nullptr )
+        ring = claimRingForThisThread();
+    
+    // every ring is in use
+    if ( ring == nullptr )
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    ++ring->depth;
+    record(*ring, name, category, 'B');
+}
+    
+void TraceRecorder::endEvent(const char* name, const char* category)
+{
+    auto* ring = findRingForThisThread();
+    
+    // the begin was dropped, so the end goes too
+    if ( ring == nullptr )
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    record(*ring, name, category, 'E');
+    
+    // the outermost event is over, the ring goes back for any thread to claim.
+    // Whatever is still in it is drained as before
+    if ( --ring->depth == 0 )
+    {
+        ring->releasedAt.store(numReleases.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        ring->owner.store(nullptr, std::memory_order_release);
+    }
+}
+
+//==============================================================================
+void TraceRecorder::record(ThreadRing& ring, const char* name, const char* category, const char& phase)
+{
+    if ( ring.events == nullptr )
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    auto write = ring.writeIndex.load(std::memory_order_relaxed);
+    
+    // full, the writer hasn't caught up
+    if ( write - ring.readIndex.load(std::memory_order_acquire) >= eventsPerThread )
+    {
+        droppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    ring.events[write % eventsPerThread] = { name, category, juce::Time::getHighResolutionTicks(), ring.thread, ring.isMessageThread, phase };
+    ring.writeIndex.store(write + 1, std::memory_order_release);
+}
+
+TraceRecorder::ThreadRing* TraceRecorder::findRingForThisThread()
+{
+    auto thisThread = juce::Thread::getCurrentThreadId();
+    
+    for ( auto& ring : rings )
+    {
+        if ( ring.owner.load(std::memory_order_acquire) == thisThread )
+            return &ring;
+    }
+    
+    return nullptr;
+}
+
+TraceRecorder::ThreadRing* TraceRecorder::claimRingForThisThread()
+{
+    auto thisThread = juce::Thread::getCurrentThreadId();
+    
+    // the ring this thread had before, if nobody has taken it since, so it keeps its track
+    for ( auto& ring : rings )
+    {
+        juce::Thread::ThreadID expected = nullptr;
+        
+        if ( ring.previousOwner.load(std::memory_order_relaxed) == thisThread
+             && ring.owner.compare_exchange_strong(expected, thisThread, std::memory_order_acq_rel) )
+            return &ring;
+    }
+    
+    // otherwise the ring that has been free longest, as a new track, so the
+    // rings of threads that come back often are the last to be taken
+    for ( auto attempt = 0; attempt < maxThreads; ++attempt )
+    {
+        ThreadRing* oldest = nullptr;
+        
+        for ( auto& ring : rings )
+        {
+            if ( ring.owner.load(std::memory_order_acquire) == nullptr
+                 && ( oldest == nullptr || ring.releasedAt.load(std::memory_order_relaxed) < oldest->releasedAt.load(std::memory_order_relaxed) ) )
+                oldest = &ring;
+        }
+        
+        if ( oldest == nullptr )
+            return nullptr;
+        
+        juce::Thread::ThreadID expected = nullptr;
+        
+        if ( oldest->owner.compare_exchange_strong(expected, thisThread, std::memory_order_acq_rel) )
+        {
+            oldest->previousOwner.store(thisThread, std::memory_order_relaxed);
+            oldest->thread = numThreadsSeen.fetch_add(1, std::memory_order_relaxed) + 1;
+            oldest->isMessageThread = juce::MessageManager::existsAndIsCurrentThread();
+            return oldest;
+        }
+    }
+    
+    return nullptr;
+}
+
+//==============================================================================
+void TraceRecorder::Writer::run()
+{
+    while ( !threadShouldExit() )
+    {
+        recorder.drain(false);
+        wait(50);
+    }
+    
+    recorder.drain(true);
+}
+
+void TraceRecorder::drain(const bool& isFinalDrain)
+{
+    for ( auto& ring : rings )
+    {
+        if ( ring.events == nullptr )
+            continue;
+        
+        auto read = ring.readIndex.load(std::memory_order_relaxed);
+        auto write = ring.writeIndex.load(std::memory_order_acquire);
+        
+        if ( read == write )
+            continue;
+        
+        // a ring can have held several threads' events since the last drain
+        for ( ; read != write; ++read )
+        {
+            auto& event = ring.events[read % eventsPerThread];
+            
+            if ( !namedThreads.contains(event.thread) )
+            {
+                writeThreadName(event);
+                namedThreads.add(event.thread);
+            }
+        
+            writeEvent(event);
+        }
+        
+        ring.readIndex.store(read, std::memory_order_release);
+    }
+    
+    if ( !isFinalDrain )
+        stream->flush();
+}
+
+void TraceRecorder::writeEvent(const Event& event)
+{
+    auto micros = juce::Time::highResolutionTicksToSeconds(event.ticks - startTicks) * 1.0e6;
+    
+    *stream << (firstEventWritten ? ",\n" : "")
+            << "{\"name\":\"" << event.name
+            << "\",\"cat\":\"" << event.category
+            << "\",\"ph\":\"" << juce::String::charToString(event.phase)
+            << "\",\"ts\":" << juce::String(micros, 3)
+            << ",\"pid\":1,\"tid\":" << juce::String(event.thread) << "}";
+    
+    firstEventWritten = true;
+}
+
+void TraceRecorder::writeThreadName(const Event& firstEvent)
+{
+    juce::String name;
+    
+    if ( firstEvent.isMessageThread )
+        name = "message thread";
+    else if ( juce::String(firstEvent.category) == "audio" )
+        name = "audio thread " + juce::String(firstEvent.thread);
+    else
+        name = "thread " + juce::String(firstEvent.thread);
+    
+    *stream << (firstEventWritten ? ",\n" : "")
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << juce::String(firstEvent.thread)
+            << ",\"args\":{\"name\":\"" << name << "\"}}";
+    
+    firstEventWritten = true;
+}
@@ -0,0 +1,133 @@
+/*
+  ==============================================================================
+
+    TraceRecorder.h
+    Created: 18 Oct 2026 7:48:26pm
+    Author:  Matt Aiken
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <memory>
+
+//==============================================================================
+/*
+In-process tracing, written out as Chrome Trace Event JSON for Perfetto or
+chrome://tracing.
+Each thread that records gets its own single producer ring, claimed without
+locks or allocation when its outermost event begins and given back when that
+event ends, so the audio thread can take part and hosts can go through any
+number of threads as long as no more than maxThreads are inside an event at
+once. A thread takes back the ring it had before when it's still free, so its
+events stay on one track. A background thread drains the rings into the file
+while recording.
+Shared by every instance through a juce::SharedResourcePointer.
+*/
+struct TraceRecorder
+{
+    TraceRecorder();
+    ~TraceRecorder();
+    
+    // message thread
+    bool startRecording(const juce::File& destination);
+    void stopRecording();
+    
+    bool isRecording() const { return recording.load(std::memory_order_acquire); }
+    juce::File getDestination() const { return destination; }
+    
+    // name and category must be string literals, only the pointers are stored
+    void beginEvent(const char* name, const char* category);
+    void endEvent(const char* name, const char* category);
+    
+    // a begin / end pair around the enclosing scope, nothing recorded if tracing was off at the start
+    struct ScopedEvent
+    {
+        ScopedEvent(TraceRecorder& r, const char* n, const char* c)
+            : recorder(r), name(n), category(c), active(r.isRecording())
+        {
+            if ( active )
+                recorder.beginEvent(name, category);
+        }
+        
+        ~ScopedEvent()
+        {
+            if ( active )
+                recorder.endEvent(name, category);
+        }
+    
+    private:
+        TraceRecorder& recorder;
+        const char* name;
+        const char* category;
+        bool active;
+        
+        JUCE_DECLARE_NON_COPYABLE(ScopedEvent)
+    };
+    
+    // threads inside an event at the same time
+    static constexpr int maxThreads = 16;
+    static constexpr juce::uint32 eventsPerThread = 1 << 14;
+
+private:
+    struct Event
+    {
+        const char* name;
+        const char* category;
+        juce::int64 ticks;
+        juce::uint32 thread;
+        bool isMessageThread;
+        char phase;
+    };
+    
+    struct ThreadRing
+    {
+        std::atomic<juce::Thread::ThreadID> owner { nullptr };
+        std::atomic<juce::Thread::ThreadID> previousOwner { nullptr };
+        std::atomic<juce::uint32> releasedAt { 0 };
+        
+        // only touched by the owner
+        juce::uint32 thread = 0;
+        bool isMessageThread = false;
+        int depth = 0;
+        
+        std::unique_ptr<Event[]> events;
+        std::atomic<juce::uint32> writeIndex { 0 };
+        std::atomic<juce::uint32> readIndex { 0 };
+    };
+    
+    struct Writer : juce::Thread
+    {
+        Writer(TraceRecorder& r) : juce::Thread("Trace writer"), recorder(r) { }
+        void run() override;
+        
+        TraceRecorder& recorder;
+    };
+    
+    void record(ThreadRing& ring, const char* name, const char* category, const char& phase);
+    ThreadRing* findRingForThisThread();
+    ThreadRing* claimRingForThisThread();
+    
+    // writer thread
+    void drain(const bool& isFinalDrain);
+    void writeEvent(const Event& event);
+    void writeThreadName(const Event& firstEvent);
+    
+    std::array<ThreadRing, maxThreads> rings;
+    std::atomic<bool> recording { false };
+    std::atomic<juce::uint32> droppedEvents { 0 };
+    std::atomic<juce::uint32> numThreadsSeen { 0 };
+    std::atomic<juce::uint32> numReleases { 0 };
+    
+    juce::File destination;
+    std::unique_ptr<juce::FileOutputStream> stream;
+    juce::int64 startTicks = 0;
+    bool firstEventWritten = false;
+    juce::SortedSet<juce::uint32> namedThreads;
+    
+    Writer writer { *this };
+};